@@ -0,0 +1,272 @@
+/*
+ * async-render.cc
+ * Render localized messages on worker threads
+ */
+
+#include "async-render.h"
+
+#include "xlate.h"
+
+using namespace std;
+
+// most jobs a worker takes off the queue at once
+static const size_t MAX_BATCH = 32;
+
+void AsyncMessageRenderer::stage_counter::add(clock::duration elapsed)
+{
+    const unsigned long long nanos
+        = chrono::duration_cast<chrono::nanoseconds>(elapsed).count();
+    count.fetch_add(1, memory_order_relaxed);
+    total_nanos.fetch_add(nanos, memory_order_relaxed);
+
+    unsigned long long old_max = max_nanos.load(memory_order_relaxed);
+    while (nanos > old_max
+           && !max_nanos.compare_exchange_weak(old_max, nanos,
+                                               memory_order_relaxed))
+    {
+    }
+}
+
+async_render_stage AsyncMessageRenderer::stage_counter::get() const
+{
+    async_render_stage result;
+    result.count = count.load(memory_order_relaxed);
+    result.total_nanos = total_nanos.load(memory_order_relaxed);
+    result.max_nanos = max_nanos.load(memory_order_relaxed);
+    return result;
+}
+
+AsyncMessageRenderer::AsyncMessageRenderer(int num_workers, size_t capacity,
+                                           async_render_overflow overflow)
+    : m_overflow(overflow), m_capacity(capacity), m_pending(0),
+      m_submitted(0), m_delivered(0), m_rendered_inline(0),
+      m_queued(), m_render(), m_reorder(), m_switch_wait(), m_switch_held(),
+      m_stopping(false)
+{
+    for (int i = 0; i < num_workers; i++)
+        m_workers.emplace_back(&AsyncMessageRenderer::_worker, this);
+}
+
+AsyncMessageRenderer::~AsyncMessageRenderer()
+{
+    // workers drain the queue before they stop
+    m_stopping.store(true);
+    _notify(m_wake, true);
+    for (thread &worker : m_workers)
+        worker.join();
+}
+
+int AsyncMessageRenderer::add_client(const string& language)
+{
+    unique_ptr<client> c(new client());
+    c->language = language;
+    c->next_seq.store(0);
+    c->next_output = 0;
+
+    lock_guard<mutex> lock(m_clients_lock);
+    m_clients.push_back(move(c));
+    return static_cast<int>(m_clients.size() - 1);
+}
+
+AsyncMessageRenderer::client &AsyncMessageRenderer::_get_client(int id)
+{
+    lock_guard<mutex> lock(m_clients_lock);
+    return *m_clients.at(id);
+}
+
+void AsyncMessageRenderer::submit(int client_id, const vector<LocalizationArg>& args)
+{
+    submit(client_id, LocalizedMessage(args));
+}
+
+void AsyncMessageRenderer::submit(int client_id, const LocalizedMessage& msg)
+{
+    client &c = _get_client(client_id);
+
+    job j;
+    j.target = &c;
+    j.seq = c.next_seq.fetch_add(1);
+    j.msg = msg;
+    j.submitted = clock::now();
+    m_submitted.fetch_add(1);
+
+    if (!m_workers.empty() && m_overflow == ASYNC_RENDER_BLOCK)
+    {
+        unique_lock<mutex> lock(m_wake_lock);
+        m_progress.wait(lock, [this] { return m_pending.load() < m_capacity; });
+    }
+
+    if (m_workers.empty() || m_pending.load() >= m_capacity)
+    {
+        // synchronous fallback
+        m_rendered_inline.fetch_add(1, memory_order_relaxed);
+        job *inline_job = &j;
+        _render(&inline_job, 1);
+        return;
+    }
+
+    m_pending.fetch_add(1);
+    m_queue.push(move(j));
+    _notify(m_wake, false);
+}
+
+void AsyncMessageRenderer::_notify(condition_variable &cond, bool all)
+{
+    {
+        lock_guard<mutex> lock(m_wake_lock);
+    }
+    if (all)
+        cond.notify_all();
+    else
+        cond.notify_one();
+}
+
+// Render and deliver jobs which are all for the same language
+void AsyncMessageRenderer::_render(job *const *jobs, size_t count)
+{
+    vector<vector<LocalizationArg>> messages(count);
+    for (size_t i = 0; i < count; i++)
+        messages[i] = jobs[i]->msg.args();
+
+    const clock::time_point start = clock::now();
+    vector<string> texts;
+    language_switch_time switch_time;
+    localize_batch_in(jobs[0]->target->language, messages, texts,
+                      &switch_time);
+    const clock::time_point rendered = clock::now();
+
+    if (switch_time.exclusive)
+    {
+        m_switch_wait.add(switch_time.wait);
+        m_switch_held.add(switch_time.held);
+    }
+
+    // (each message gets its share of the batch)
+    for (size_t i = 0; i < count; i++)
+    {
+        m_render.add((rendered - start) / count);
+        _deliver(*jobs[i]->target, jobs[i]->seq, move(texts[i]), rendered);
+    }
+}
+
+void AsyncMessageRenderer::_deliver(client &c, uint64_t seq, string text,
+                                    clock::time_point rendered)
+{
+    unsigned long delivered = 0;
+    {
+        lock_guard<mutex> lock(c.lock);
+        if (seq != c.next_output)
+        {
+            // an earlier message is still being rendered
+            c.waiting.emplace(seq, make_pair(move(text), rendered));
+            return;
+        }
+
+        c.output.push_back(move(text));
+        m_reorder.add(clock::now() - rendered);
+        ++c.next_output;
+        ++delivered;
+
+        // anything which was waiting for this one
+        auto it = c.waiting.begin();
+        while (it != c.waiting.end() && it->first == c.next_output)
+        {
+            c.output.push_back(move(it->second.first));
+            m_reorder.add(clock::now() - it->second.second);
+            ++c.next_output;
+            ++delivered;
+            it = c.waiting.erase(it);
+        }
+    }
+
+    m_delivered.fetch_add(delivered);
+    _notify(m_progress, true);
+}
+
+void AsyncMessageRenderer::_worker()
+{
+    vector<job> batch;
+    vector<job*> group;
+    while (true)
+    {
+        batch.clear();
+        {
+            lock_guard<mutex> lock(m_pop_lock);
+            job j;
+            while (batch.size() < MAX_BATCH && m_queue.pop(j))
+                batch.push_back(move(j));
+        }
+
+        if (batch.empty())
+        {
+            if (m_stopping.load() && m_pending.load() == 0)
+                break;
+            // (pending counts a job from just before it's pushed until it's
+            // popped, so this may wake a little early and go round again)
+            unique_lock<mutex> lock(m_wake_lock);
+            m_wake.wait(lock, [this]
+                        {
+                            return m_pending.load() > 0 || m_stopping.load();
+                        });
+            continue;
+        }
+
+        m_pending.fetch_sub(batch.size());
+        const clock::time_point now = clock::now();
+        for (const job &j : batch)
+            m_queued.add(now - j.submitted);
+
+        // a language at a time, so at most one switch each; within a
+        // language, in the order submitted
+        vector<bool> done(batch.size(), false);
+        for (size_t i = 0; i < batch.size(); i++)
+        {
+            if (done[i])
+                continue;
+            const string &language = batch[i].target->language;
+            group.clear();
+            for (size_t k = i; k < batch.size(); k++)
+            {
+                if (!done[k] && batch[k].target->language == language)
+                {
+                    group.push_back(&batch[k]);
+                    done[k] = true;
+                }
+            }
+            _render(group.data(), group.size());
+        }
+    }
+}
+
+bool AsyncMessageRenderer::fetch(int client_id, string& text)
+{
+    client &c = _get_client(client_id);
+    lock_guard<mutex> lock(c.lock);
+    if (c.output.empty())
+        return false;
+    text = move(c.output.front());
+    c.output.pop_front();
+    return true;
+}
+
+void AsyncMessageRenderer::flush()
+{
+    unique_lock<mutex> lock(m_wake_lock);
+    m_progress.wait(lock, [this]
+                    {
+                        return m_delivered.load() >= m_submitted.load();
+                    });
+}
+
+async_render_stats AsyncMessageRenderer::stats() const
+{
+    async_render_stats result;
+    result.submitted = m_submitted.load();
+    result.rendered_inline = m_rendered_inline.load();
+    result.queued = m_queued.get();
+    result.render = m_render.get();
+    result.reorder = m_reorder.get();
+    result.switch_wait = m_switch_wait.get();
+    result.switch_held = m_switch_held.get();
+    return result;
+}
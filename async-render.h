@@ -0,0 +1,181 @@
+/*
+ * async-render.h
+ * Render localized messages on worker threads
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+using std::string;
+using std::vector;
+
+#include "localize.h"
+#include "localized-message.h"
+#include "mpsc-queue.h"
+
+// What submit() does when the queue is full
+enum async_render_overflow
+{
+    ASYNC_RENDER_INLINE,  // render on the calling thread
+    ASYNC_RENDER_BLOCK,   // wait for the workers to catch up
+};
+
+// Latency of one stage of the pipeline
+struct async_render_stage
+{
+    unsigned long count = 0;
+    unsigned long long total_nanos = 0;
+    unsigned long long max_nanos = 0;
+
+    double average_usecs() const
+    {
+        return count ? total_nanos / 1000.0 / count : 0.0;
+    }
+};
+
+struct async_render_stats
+{
+    unsigned long submitted = 0;
+    // rendered on the caller's thread (no workers, or queue full)
+    unsigned long rendered_inline = 0;
+
+    // submit() to a worker picking the message up
+    async_render_stage queued;
+    // translating and formatting
+    async_render_stage render;
+    // rendered to being in order in the client's output
+    async_render_stage reorder;
+
+    // Renders which needed a language other than the current one: how long
+    // they waited for the language lock, and how long they then held it,
+    // during which localize() on every other thread was blocked. There is
+    // one per batch of messages for a language, not one per message.
+    async_render_stage switch_wait;
+    async_render_stage switch_held;
+};
+
+/*
+ * Callers on any thread submit messages for a client; a pool of workers
+ * renders them with localize() in the client's language and each client's
+ * output comes out in the order its messages were submitted.
+ *
+ * A worker takes whatever is queued (up to a batch) and renders it a
+ * language at a time.
+ *
+ * Submitting only pushes onto a lock-free queue. When the queue is full (or
+ * there are no workers) the message is rendered on the calling thread
+ * instead, or the caller waits, depending on the overflow policy. Either
+ * way, ordering is preserved.
+ *
+ * Workers render with localize_batch_in(), so those rendering in the
+ * current language run in parallel (with each other and with localize() on
+ * other threads). But one which needs a different language has localization
+ * to itself while it switches, renders its batch, and switches back: for
+ * that long, the game thread blocks in localize(), localize_pronoun() and
+ * get_localization_language(). So clients in languages other than the
+ * game's put rendering back on the game thread's path, though only once per
+ * batch; stats() shows the cost (switch_held).
+ */
+class AsyncMessageRenderer
+{
+public:
+    AsyncMessageRenderer(int num_workers = 2, size_t capacity = 1024,
+                         async_render_overflow overflow = ASYNC_RENDER_INLINE);
+    ~AsyncMessageRenderer();
+
+    AsyncMessageRenderer(const AsyncMessageRenderer&) = delete;
+    AsyncMessageRenderer& operator=(const AsyncMessageRenderer&) = delete;
+
+    // returns the id to submit and fetch with
+    int add_client(const string& language);
+
+    void submit(int client, const vector<LocalizationArg>& args);
+    void submit(int client, const LocalizedMessage& msg);
+
+    // next rendered message for the client, if there is one
+    bool fetch(int client, string& text);
+
+    // wait until everything submitted so far is in the output queues
+    void flush();
+
+    async_render_stats stats() const;
+
+private:
+    typedef std::chrono::steady_clock clock;
+
+    struct client
+    {
+        string language;
+        std::atomic<uint64_t> next_seq;
+
+        std::mutex lock;
+        // everything below is protected by lock
+        uint64_t next_output;
+        // rendered ahead of an earlier message: (text, time rendered)
+        std::map<uint64_t, std::pair<string, clock::time_point>> waiting;
+        std::deque<string> output;
+    };
+
+    struct job
+    {
+        client *target;
+        uint64_t seq;
+        LocalizedMessage msg;
+        clock::time_point submitted;
+    };
+
+    struct stage_counter
+    {
+        std::atomic<unsigned long> count;
+        std::atomic<unsigned long long> total_nanos;
+        std::atomic<unsigned long long> max_nanos;
+
+        void add(clock::duration elapsed);
+        async_render_stage get() const;
+    };
+
+    client &_get_client(int id);
+    void _worker();
+    void _render(job *const *jobs, size_t count);
+    void _notify(std::condition_variable &cond, bool all);
+    void _deliver(client &c, uint64_t seq, string text,
+                  clock::time_point rendered);
+
+    async_render_overflow m_overflow;
+    size_t m_capacity;
+
+    mpsc_queue<job> m_queue;
+    std::mutex m_pop_lock;
+    std::atomic<size_t> m_pending;
+
+    std::mutex m_clients_lock;
+    vector<std::unique_ptr<client>> m_clients;
+
+    // Waiters check their condition under m_wake_lock, so notifiers take it
+    // (briefly) before notifying, else a wake-up could be missed.
+    std::mutex m_wake_lock;
+    std::condition_variable m_wake;         // something to do
+    std::condition_variable m_progress;     // something delivered
+    std::atomic<unsigned long> m_submitted;
+    std::atomic<unsigned long> m_delivered;
+
+    std::atomic<unsigned long> m_rendered_inline;
+    stage_counter m_queued;
+    stage_counter m_render;
+    stage_counter m_reorder;
+    stage_counter m_switch_wait;
+    stage_counter m_switch_held;
+
+    std::atomic<bool> m_stopping;
+    vector<std::thread> m_workers;
+};
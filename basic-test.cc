@@ -1,9 +1,17 @@
+#include <cmath>
 #include <iostream>
+#include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string>
 
+#include "async-render.h"
+#include "german.h"
 #include "localize.h"
+#include "localized-message.h"
+#include "message-log.h"
+#include "multi-replace.h"
+#include "number-words.h"
 #include "test-util.h"
 
 using namespace std;
@@ -82,5 +90,161 @@ int main(int argc, char *argv[])
     args.push_back(LocalizationArg("the orc"));
     result = localize_sentence(args);
     check_result("arg order", "The orc is hit by the arrow.", result);
+
+    // deferred localization
+    LocalizedMessage msg(LocalizationArg("%d%% of %s: %.2f"), LocalizationArg(50),
+                         LocalizationArg("a flip flop", "%d flip flops", 2));
+    msg.add_arg(LocalizationArg(PI));
+    check_result("deferred not rendered", "false", msg.is_rendered() ? "true" : "false");
+    check_result("deferred", "50% of a pair of thongs: 3.14", msg.str());
+    check_result("deferred rendered", "true", msg.is_rendered() ? "true" : "false");
+    check_result("deferred args", localize(msg.args()), msg.str());
+    const string& rendered_au = msg.str();
+
+    init_localization("en");
+    check_result("deferred other language", "50% of 2 flip flops: 3.14", msg.str());
+    check_result("deferred kept", "50% of a pair of thongs: 3.14", rendered_au);
+    init_localization("en_AU");
+    check_result("deferred sentence", "50% of a pair of thongs: 3.14", msg.sentence());
+
+    // binary message log
+    stringstream log;
+    MessageLogWriter writer(log);
+    const string expected = localize_sentence(args);
+    writer.write(args);
+    writer.write(msg);
+    writer.write(msg);
+    args.clear();
+    args.push_back(LocalizationArg("%lld, %ld, %d, %.15Lf"));
+    args.push_back(LocalizationArg(-6LL));
+    args.push_back(LocalizationArg(-5L));
+    args.push_back(LocalizationArg(-4));
+    args.push_back(LocalizationArg(PI_LONG));
+    writer.write(args);
+
+    MessageLogReader reader(log);
+    check_result("log header", "true", reader.valid() ? "true" : "false");
+    reader.read(args);
+    result = localize_sentence(args);
+    check_result("log string args", expected, result);
+    reader.read_rendered(result);
+    check_result("log mixed args", "50% of a pair of thongs: 3.14", result);
+    LocalizedMessage msg2;
+    reader.read(msg2);
+    check_result("log interned", msg.str(), msg2.str());
+    reader.read_rendered(result);
+    check_result("log numbers", "-6, -5, -4, 3.141592653589793", result);
+    check_result("log end", "false", reader.read_rendered(result) ? "true" : "false");
+
+    // several languages at once
+    vector<string> languages;
+    languages.push_back("en");
+    languages.push_back("en_AU");
+    vector<string> results;
+    localize_multi(msg.args(), languages, results);
+    check_result("multi en", "50% of 2 flip flops: 3.14", results.at(0));
+    check_result("multi en_AU", "50% of a pair of thongs: 3.14", results.at(1));
+    check_result("multi restores language", "en_AU", get_localization_language());
+
+    // rendering on worker threads
+    {
+        AsyncMessageRenderer renderer(3, 16);
+        const int en = renderer.add_client("en");
+        const int en_au = renderer.add_client("en_AU");
+        for (int i = 0; i < 100; i++)
+        {
+            args.clear();
+            args.push_back(LocalizationArg("%d: %s"));
+            args.push_back(LocalizationArg(i));
+            args.push_back(LocalizationArg("a flip flop", "%d flip flops", i));
+            renderer.submit(en, args);
+            renderer.submit(en_au, args);
+        }
+        // meanwhile, this thread stays in its own language
+        int wrong_language = 0;
+        for (int i = 0; i < 200; i++)
+        {
+            if (localize(LocalizationArg("a flip flop", "%d flip flops", 2))
+                != "a pair of thongs")
+            {
+                wrong_language++;
+            }
+        }
+        renderer.flush();
+        check_result("async main thread language", "0", to_string(wrong_language));
+        // the en client needs a switch, but not one per message
+        const async_render_stats stats = renderer.stats();
+        check_result("async switches batched", "true",
+                     stats.switch_held.count > 0 && stats.switch_held.count <= 100
+                         ? "true" : "false");
+
+        string en_expected, en_actual, en_au_expected, en_au_actual;
+        for (int i = 0; i < 100; i++)
+        {
+            const string count = to_string(i);
+            en_expected += count + ": " + (i == 1 ? "a flip flop" : count + " flip flops") + "\n";
+            en_au_expected += count + ": " + (i == 1 ? "a thong" : i == 2 ? "a pair of thongs"
+                                                     : count + " thongs") + "\n";
+        }
+        while (renderer.fetch(en, result))
+            en_actual += result + "\n";
+        while (renderer.fetch(en_au, result))
+            en_au_actual += result + "\n";
+        check_result("async in order", "true", en_actual == en_expected ? "true" : "false");
+        check_result("async other language", "true",
+                     en_au_actual == en_au_expected ? "true" : "false");
+        check_result("async language unchanged", "en_AU", get_localization_language());
+    }
+
+    // German cases are declined from the nominative in the catalog
+    init_localization("de");
+    german_decline("monsters", "akk", "the orc", "", 1, result);
+    check_result("decline definite akk", "den Ork", result);
+    german_decline("monsters", "dat", "a frilled lizard", "%d frilled lizards", 1, result);
+    check_result("decline indefinite dat", "einer gekräuselten Eidechse", result);
+    german_decline("monsters", "dat", "a frilled lizard", "%d frilled lizards", 3, result);
+    check_result("decline plural dat", "%d gekräuselten Eidechsen", result);
+    const german_case_bundle *orc = german_cases("monsters", "an orc", "%d orcs");
+    check_result("case bundle", "ein Ork|einen Ork|einem Ork|%d Orke",
+                 string(orc->singular[GCASE_NOM]) + "|" + string(orc->singular[GCASE_AKK])
+                 + "|" + string(orc->singular[GCASE_DAT]) + "|" + string(orc->plural[GCASE_AKK]));
+    check_result("case bundle cached", "true",
+                 orc == german_cases("monsters", "an orc", "%d orcs") ? "true" : "false");
+    check_result("pronoun agrees", "sie",
+                 localize_pronoun("monsters", "the frilled lizard", GENDER_MALE, PRONOUN_SUBJECTIVE));
+    check_result("pronoun agrees akk", "ihn",
+                 localize_pronoun("monsters", "an orc", GENDER_NEUTER, PRONOUN_OBJECTIVE));
+    check_result("pronoun natural gender", "sie",
+                 localize_pronoun("monsters", "Sigmund", GENDER_FEMALE, PRONOUN_SUBJECTIVE));
+    check_result("pronoun second person", "du",
+                 localize_pronoun("monsters", "you", GENDER_YOU, PRONOUN_SUBJECTIVE));
+    check_result("pronoun second person refl", "dich",
+                 localize_pronoun("monsters", "an orc", GENDER_YOU, PRONOUN_REFLEXIVE));
+    check_result("decline unknown", "false",
+                 german_decline("monsters", "dat", "the xyzzy", "", 1, result) ? "true" : "false");
+    check_result("number words", "dreihundertzweiundvierzig", number_in_words(342, "de"));
+    check_result("number words compound", "einhunderteintausendeins", number_in_words(101001, "de"));
+    check_result("number words millions", "zwei Millionen eins", number_in_words(2000001, "de"));
+    check_result("decimal comma", "3,14|1.234.567", localize("%.2f|%'d", PI, 1234567));
+    languages.clear();
+    languages.push_back("de");
+    languages.push_back("en");
+    localize_multi({LocalizationArg("%.1f"), LocalizationArg(2.5)}, languages, results);
+    check_result("multi punctuation", "2,5|2.5", results.at(0) + "|" + results.at(1));
+    init_localization("en_AU");
+    check_result("number flags", "42   |00042|+042|0x2a|052|-1,234,567",
+                 localize("%-5d|%05d|%+.3d|%#x|%#o|%'d", 42, 42, 42, 42u, 42u, -1234567));
+    check_result("number floats", "3.142e+00|3.14159|1E+20|  -2.50|inf",
+                 localize("%.3e|%g|%G|%7.2f|%f", PI, PI, 1e20, -2.5, HUGE_VAL));
+    const multi_replacer replacer({{"he", "HE"}, {"hers", "HERS"}, {"she", "SHE"}, {"is", "IS"}});
+    check_result("multi replace", "uSHErs hIS HERSelf", replacer.replace("ushers his herself"));
+    check_result("string width", "[  abc|ab ]", localize("[%5s|%-3.2s]", "abc", "abc"));
+    check_result("number words english", "two million three hundred forty-two",
+                 number_in_words(2000342, "en"));
+    check_result("pronoun english", "he",
+                 localize_pronoun("monsters", "the frilled lizard", GENDER_MALE, PRONOUN_SUBJECTIVE));
+    check_result("pronoun english second person", "yourself",
+                 localize_pronoun("monsters", "you", GENDER_YOU, PRONOUN_REFLEXIVE));
+
     return 0;
 }
@@ -0,0 +1,134 @@
+/*
+ * bitary-test.cc
+ * Check the bit vectors
+ */
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AppHdr.h"
+#include "bitary.h"
+#include "test-util.h"
+
+using namespace std;
+
+template <class Bits>
+static string _set_bits(const Bits &bits)
+{
+    string result;
+    for (unsigned int i : bits.set_bits())
+        result += (result.empty() ? "" : " ") + to_string(i);
+    return result;
+}
+
+// bit_vector against vector<bool>, on random bits
+static int _bit_vector_mismatches(unsigned long size, mt19937 &rng)
+{
+    vector<bool> a(size), b(size);
+    bit_vector va(size), vb(size);
+    for (unsigned long i = 0; i < size; i++)
+    {
+        a[i] = rng() % 3 == 0;
+        b[i] = rng() % 2 == 0;
+        va.set(i, a[i]);
+        vb.set(i, b[i]);
+    }
+
+    int bad = 0;
+    bit_vector and_v = va & vb, or_v = va | vb, xor_v = va ^ vb;
+    bit_vector and_not_v(va);
+    and_not_v.and_not(vb);
+    bit_vector or_and_v(vb);
+    or_and_v.or_and(va, and_v);
+    unsigned long set_count = 0;
+    for (unsigned long i = 0; i < size; i++)
+    {
+        bad += and_v.get(i) != (a[i] && b[i]);
+        bad += or_v.get(i) != (a[i] || b[i]);
+        bad += xor_v.get(i) != (a[i] != b[i]);
+        bad += and_not_v.get(i) != (a[i] && !b[i]);
+        bad += or_and_v.get(i) != b[i];
+        bad += va.rank(i) != set_count;
+        if (a[i])
+        {
+            bad += va.select(set_count) != i;
+            bad += va.find_next(i ? i - 1 : 0) > i;
+            set_count++;
+        }
+    }
+    bad += va.count() != set_count;
+    bad += va.select(set_count) != size;
+
+    const unsigned long shift = rng() % (size + 1);
+    bit_vector up(va), down(va);
+    up <<= shift;
+    down >>= shift;
+    for (unsigned long i = 0; i < size; i++)
+    {
+        bad += up.get(i) != (i >= shift && a[i - shift]);
+        bad += down.get(i) != (i + shift < size && a[i + shift]);
+    }
+
+    const unsigned long begin = rng() % (size + 1);
+    const unsigned long end = begin + rng() % (size - begin + 1);
+    bit_vector range(size);
+    range.set_range(begin, end);
+    bad += range.count() != end - begin;
+    bad += end > begin && (range.find_first() != begin || range.rank(end) != end - begin);
+    range.set_range(begin, end, false);
+    bad += range.any();
+    return bad;
+}
+
+int main()
+{
+    FixedBitVector<130> bits;
+    check_result("fixed empty", "", _set_bits(bits));
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(129);
+    check_result("fixed set bits", "0 63 64 129", _set_bits(bits));
+    check_result("fixed count", "4", to_string(bits.count()));
+    check_result("fixed find next", "64 130", to_string(bits.find_next(64))
+                 + " " + to_string(bits.find_next(130)));
+
+    string visited;
+    bits.for_each_set([&](unsigned int i) { visited += to_string(i) + ","; });
+    check_result("fixed for each", "0,63,64,129,", visited);
+
+    const auto mask = FixedBitVector<130>::mask({5, 64});
+    check_result("fixed intersects", "true false",
+                 string(bits.intersects(mask) ? "true" : "false")
+                 + (bits.contains_all(mask) ? " true" : " false"));
+    check_result("fixed and", "64", _set_bits(bits & mask));
+
+    bits.init(true);
+    check_result("fixed init", "130 129", to_string(bits.count()) + " "
+                 + to_string(bits.find_next(129)));
+
+    mt19937 rng(42);
+    int mismatches = 0;
+    const unsigned long sizes[] = { 1, 63, 64, 65, 200, 256, 257, 1000, 80 * 70 };
+    for (unsigned long size : sizes)
+        mismatches += _bit_vector_mismatches(size, rng);
+    check_result("bit vector ops", "0", to_string(mismatches));
+
+    bit_vector big(1000);
+    big.set(999);
+    bit_vector moved(std::move(big));
+    bit_vector small(10);
+    small.set(3);
+    bit_vector small_moved(std::move(small));
+    check_result("bit vector move", "999 1000 3 0",
+                 to_string(moved.find_first()) + " " + to_string(moved.length())
+                 + " " + to_string(small_moved.find_first())
+                 + " " + to_string(big.length()));
+    bit_vector assigned;
+    assigned = small_moved;
+    check_result("bit vector copy", "true", assigned == small_moved ? "true" : "false");
+
+    return 0;
+}
@@ -7,73 +7,466 @@
 
 #include "bitary.h"
 
+#include <cstring>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Word-parallel operations: each has a scalar version, and SIMD versions
+// for whatever the build allows.
+struct bits_and
+{
+    uint64_t operator()(uint64_t a, uint64_t b) const { return a & b; }
+#ifdef __AVX2__
+    __m256i operator()(__m256i a, __m256i b) const
+    {
+        return _mm256_and_si256(a, b);
+    }
+#endif
+#ifdef __SSE2__
+    __m128i operator()(__m128i a, __m128i b) const { return _mm_and_si128(a, b); }
+#endif
+};
+
+struct bits_or
+{
+    uint64_t operator()(uint64_t a, uint64_t b) const { return a | b; }
+#ifdef __AVX2__
+    __m256i operator()(__m256i a, __m256i b) const
+    {
+        return _mm256_or_si256(a, b);
+    }
+#endif
+#ifdef __SSE2__
+    __m128i operator()(__m128i a, __m128i b) const { return _mm_or_si128(a, b); }
+#endif
+};
+
+struct bits_xor
+{
+    uint64_t operator()(uint64_t a, uint64_t b) const { return a ^ b; }
+#ifdef __AVX2__
+    __m256i operator()(__m256i a, __m256i b) const
+    {
+        return _mm256_xor_si256(a, b);
+    }
+#endif
+#ifdef __SSE2__
+    __m128i operator()(__m128i a, __m128i b) const { return _mm_xor_si128(a, b); }
+#endif
+};
+
+// a & ~b
+struct bits_and_not
+{
+    uint64_t operator()(uint64_t a, uint64_t b) const { return a & ~b; }
+#ifdef __AVX2__
+    __m256i operator()(__m256i a, __m256i b) const
+    {
+        return _mm256_andnot_si256(b, a);
+    }
+#endif
+#ifdef __SSE2__
+    __m128i operator()(__m128i a, __m128i b) const
+    {
+        return _mm_andnot_si128(b, a);
+    }
+#endif
+};
+
+// dst[i] = op(a[i], b[i]); dst may be a or b
+template <class Op>
+static void _combine(uint64_t *dst, const uint64_t *a, const uint64_t *b,
+                     int nwords, Op op)
+{
+    int w = 0;
+#ifdef __AVX2__
+    for (; w + 4 <= nwords; w += 4)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(a + w));
+        const __m256i y = _mm256_loadu_si256((const __m256i *)(b + w));
+        _mm256_storeu_si256((__m256i *)(dst + w), op(x, y));
+    }
+#endif
+#ifdef __SSE2__
+    for (; w + 2 <= nwords; w += 2)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *)(a + w));
+        const __m128i y = _mm_loadu_si128((const __m128i *)(b + w));
+        _mm_storeu_si128((__m128i *)(dst + w), op(x, y));
+    }
+#endif
+    for (; w < nwords; ++w)
+        dst[w] = op(a[w], b[w]);
+}
+
+static inline int _words_for(unsigned long bits)
+{
+    return static_cast<int>((bits + 63) / 64);
+}
+
 bit_vector::bit_vector(unsigned long s)
-    : size(s)
+    : size(0), nwords(0), data(inline_data)
 {
-    nwords = static_cast<int>((size + LONGSIZE - 1) / LONGSIZE);
-    data = new unsigned long[nwords];
+    allocate(s);
     reset();
 }
 
-bit_vector::bit_vector(const bit_vector& other) : size(other.size)
+bit_vector::bit_vector(const bit_vector& other)
+    : size(0), nwords(0), data(inline_data)
 {
-    nwords = static_cast<int>((size + LONGSIZE - 1) / LONGSIZE);
-    data = new unsigned long[nwords];
-    for (int w = 0; w < nwords; ++w)
-        data[w] = other.data[w];
+    allocate(other.size);
+    memcpy(data, other.data, nwords * sizeof(uint64_t));
+}
+
+bit_vector::bit_vector(bit_vector&& other) noexcept
+    : size(other.size), nwords(other.nwords), data(inline_data)
+{
+    if (other.data == other.inline_data)
+        memcpy(inline_data, other.inline_data, sizeof(inline_data));
+    else
+        data = other.data;
+
+    other.size = 0;
+    other.nwords = 0;
+    other.data = other.inline_data;
 }
 
 bit_vector::~bit_vector()
 {
-    delete[] data;
+    if (data != inline_data)
+        delete[] data;
+}
+
+bit_vector& bit_vector::operator = (const bit_vector& other)
+{
+    if (this != &other)
+    {
+        allocate(other.size);
+        memcpy(data, other.data, nwords * sizeof(uint64_t));
+    }
+    return *this;
+}
+
+bit_vector& bit_vector::operator = (bit_vector&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (data != inline_data)
+            delete[] data;
+        data = inline_data;
+
+        size = other.size;
+        nwords = other.nwords;
+        if (other.data == other.inline_data)
+            memcpy(inline_data, other.inline_data, sizeof(inline_data));
+        else
+            data = other.data;
+
+        other.size = 0;
+        other.nwords = 0;
+        other.data = other.inline_data;
+    }
+    return *this;
+}
+
+// Make room for new_size bits, keeping the storage if it's big enough.
+// The contents are undefined afterwards.
+void bit_vector::allocate(unsigned long new_size)
+{
+    const int new_words = _words_for(new_size);
+    const int capacity = data == inline_data ? INLINE_WORDS : nwords;
+    if (new_words > capacity)
+    {
+        if (data != inline_data)
+            delete[] data;
+        data = new uint64_t[new_words];
+    }
+    size = new_size;
+    nwords = new_words;
+}
+
+void bit_vector::clear_tail()
+{
+    if (size % 64)
+        data[nwords - 1] &= (uint64_t(1) << (size % 64)) - 1;
 }
 
 void bit_vector::reset()
 {
-    for (int w = 0; w < nwords; ++w)
-        data[w] = 0;
+    memset(data, 0, nwords * sizeof(uint64_t));
+}
+
+void bit_vector::init(bool value)
+{
+    memset(data, value ? 0xff : 0, nwords * sizeof(uint64_t));
+    clear_tail();
 }
 
 bool bit_vector::get(unsigned long index) const
 {
     ASSERT(index < size);
-    int w = index / LONGSIZE;
-    int b = index % LONGSIZE;
-    return data[w] & (1UL << b);
+    return data[index / 64] >> (index % 64) & 1;
 }
 
 void bit_vector::set(unsigned long index, bool value)
 {
     ASSERT(index < size);
-    int w = index / LONGSIZE;
-    int b = index % LONGSIZE;
+    const uint64_t bit = uint64_t(1) << (index % 64);
     if (value)
-        data[w] |= (1UL << b);
+        data[index / 64] |= bit;
     else
-        data[w] &= ~(1UL << b);
+        data[index / 64] &= ~bit;
+}
+
+void bit_vector::set_range(unsigned long begin, unsigned long end, bool value)
+{
+    ASSERT(begin <= end && end <= size);
+    if (begin == end)
+        return;
+
+    const unsigned long first = begin / 64;
+    const unsigned long last = (end - 1) / 64;
+    const uint64_t first_mask = ~uint64_t(0) << (begin % 64);
+    const uint64_t last_mask = ~uint64_t(0) >> (63 - (end - 1) % 64);
+
+    if (first == last)
+    {
+        const uint64_t mask = first_mask & last_mask;
+        data[first] = value ? data[first] | mask : data[first] & ~mask;
+        return;
+    }
+
+    data[first] = value ? data[first] | first_mask : data[first] & ~first_mask;
+    if (last > first + 1)
+    {
+        memset(data + first + 1, value ? 0xff : 0,
+               (last - first - 1) * sizeof(uint64_t));
+    }
+    data[last] = value ? data[last] | last_mask : data[last] & ~last_mask;
+}
+
+unsigned long bit_vector::count() const
+{
+    unsigned long n = 0;
+    for (int w = 0; w < nwords; ++w)
+        n += __builtin_popcountll(data[w]);
+    return n;
+}
+
+bool bit_vector::any() const
+{
+    for (int w = 0; w < nwords; ++w)
+        if (data[w])
+            return true;
+    return false;
+}
+
+bool bit_vector::operator == (const bit_vector& other) const
+{
+    return size == other.size
+           && !memcmp(data, other.data, nwords * sizeof(uint64_t));
+}
+
+unsigned long bit_vector::find_next(unsigned long index) const
+{
+    if (index >= size)
+        return size;
+
+    int w = index / 64;
+    uint64_t bits = data[w] & (~uint64_t(0) << (index % 64));
+    while (!bits)
+    {
+        if (++w == nwords)
+            return size;
+        bits = data[w];
+    }
+    return w * 64UL + __builtin_ctzll(bits);
+}
+
+unsigned long bit_vector::rank(unsigned long index) const
+{
+    ASSERT(index <= size);
+    const int whole = index / 64;
+    unsigned long n = 0;
+    for (int w = 0; w < whole; ++w)
+        n += __builtin_popcountll(data[w]);
+    if (index % 64)
+        n += __builtin_popcountll(data[whole] & ((uint64_t(1) << (index % 64)) - 1));
+    return n;
+}
+
+unsigned long bit_vector::select(unsigned long n) const
+{
+    for (int w = 0; w < nwords; ++w)
+    {
+        uint64_t bits = data[w];
+        const unsigned long in_word = __builtin_popcountll(bits);
+        if (n >= in_word)
+        {
+            n -= in_word;
+            continue;
+        }
+        // drop the lowest n set bits
+        for (; n; --n)
+            bits &= bits - 1;
+        return w * 64UL + __builtin_ctzll(bits);
+    }
+    return size;
 }
 
 bit_vector& bit_vector::operator |= (const bit_vector& other)
 {
     ASSERT(size == other.size);
-    for (int w = 0; w < nwords; ++w)
-        data[w] |= other.data[w];
+    _combine(data, data, other.data, nwords, bits_or());
     return *this;
 }
 
 bit_vector& bit_vector::operator &= (const bit_vector& other)
 {
     ASSERT(size == other.size);
-    for (int w = 0; w < nwords; ++w)
-        data[w] &= other.data[w];
+    _combine(data, data, other.data, nwords, bits_and());
     return *this;
 }
 
-bit_vector bit_vector::operator & (const bit_vector& other) const
+bit_vector& bit_vector::operator ^= (const bit_vector& other)
 {
     ASSERT(size == other.size);
-    bit_vector res = bit_vector(size);
-    for (int w = 0; w < nwords; ++w)
-        res.data[w] = data[w] & other.data[w];
+    _combine(data, data, other.data, nwords, bits_xor());
+    return *this;
+}
+
+bit_vector& bit_vector::and_not(const bit_vector& other)
+{
+    ASSERT(size == other.size);
+    _combine(data, data, other.data, nwords, bits_and_not());
+    return *this;
+}
+
+bit_vector bit_vector::operator & (const bit_vector& other) const
+{
+    bit_vector res;
+    res.assign_and(*this, other);
+    return res;
+}
+
+bit_vector bit_vector::operator | (const bit_vector& other) const
+{
+    bit_vector res;
+    res.assign_or(*this, other);
+    return res;
+}
+
+bit_vector bit_vector::operator ^ (const bit_vector& other) const
+{
+    bit_vector res;
+    res.assign_xor(*this, other);
     return res;
 }
+
+void bit_vector::assign_and(const bit_vector& a, const bit_vector& b)
+{
+    ASSERT(a.size == b.size);
+    allocate(a.size);
+    _combine(data, a.data, b.data, nwords, bits_and());
+}
+
+void bit_vector::assign_or(const bit_vector& a, const bit_vector& b)
+{
+    ASSERT(a.size == b.size);
+    allocate(a.size);
+    _combine(data, a.data, b.data, nwords, bits_or());
+}
+
+void bit_vector::assign_xor(const bit_vector& a, const bit_vector& b)
+{
+    ASSERT(a.size == b.size);
+    allocate(a.size);
+    _combine(data, a.data, b.data, nwords, bits_xor());
+}
+
+void bit_vector::assign_and_not(const bit_vector& a, const bit_vector& b)
+{
+    ASSERT(a.size == b.size);
+    allocate(a.size);
+    _combine(data, a.data, b.data, nwords, bits_and_not());
+}
+
+void bit_vector::or_and(const bit_vector& a, const bit_vector& b)
+{
+    ASSERT(size == a.size && size == b.size);
+    int w = 0;
+#ifdef __AVX2__
+    for (; w + 4 <= nwords; w += 4)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(a.data + w));
+        const __m256i y = _mm256_loadu_si256((const __m256i *)(b.data + w));
+        const __m256i d = _mm256_loadu_si256((const __m256i *)(data + w));
+        _mm256_storeu_si256((__m256i *)(data + w),
+                            _mm256_or_si256(d, _mm256_and_si256(x, y)));
+    }
+#endif
+#ifdef __SSE2__
+    for (; w + 2 <= nwords; w += 2)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *)(a.data + w));
+        const __m128i y = _mm_loadu_si128((const __m128i *)(b.data + w));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(data + w));
+        _mm_storeu_si128((__m128i *)(data + w),
+                         _mm_or_si128(d, _mm_and_si128(x, y)));
+    }
+#endif
+    for (; w < nwords; ++w)
+        data[w] |= a.data[w] & b.data[w];
+}
+
+bit_vector& bit_vector::operator <<= (unsigned long shift)
+{
+    if (shift >= size)
+    {
+        reset();
+        return *this;
+    }
+
+    const int word_shift = shift / 64;
+    const int bit_shift = shift % 64;
+    for (int w = nwords - 1; w >= 0; --w)
+    {
+        const int from = w - word_shift;
+        uint64_t bits = 0;
+        if (from >= 0)
+        {
+            bits = data[from] << bit_shift;
+            if (bit_shift && from > 0)
+                bits |= data[from - 1] >> (64 - bit_shift);
+        }
+        data[w] = bits;
+    }
+    clear_tail();
+    return *this;
+}
+
+bit_vector& bit_vector::operator >>= (unsigned long shift)
+{
+    if (shift >= size)
+    {
+        reset();
+        return *this;
+    }
+
+    const int word_shift = shift / 64;
+    const int bit_shift = shift % 64;
+    for (int w = 0; w < nwords; ++w)
+    {
+        const int from = w + word_shift;
+        uint64_t bits = 0;
+        if (from < nwords)
+        {
+            bits = data[from] >> bit_shift;
+            if (bit_shift && from + 1 < nwords)
+                bits |= data[from + 1] << (64 - bit_shift);
+        }
+        data[w] = bits;
+    }
+    return *this;
+}
@@ -2,36 +2,99 @@
  * @file
  * @brief Bit array data type.
  *
- * Just contains the operations required by los.cc
- * for the moment.
+ * bit_vector is sized at runtime (e.g. for LOS masks and monster filters
+ * over a whole level); the Fixed ones at compile time.
 **/
 
 #pragma once
 
 #include <bitset>
+#include <cstdint>
+#include <initializer_list>
 
 #include "defines.h"
 
+// A bit vector whose size is chosen at runtime. Small ones (up to
+// INLINE_BITS) are kept inline; bigger ones on the heap. Bits past the end
+// are always kept clear, so whole-word operations can ignore the size.
 class bit_vector
 {
 public:
+    static constexpr int INLINE_WORDS = 4;
+    static constexpr unsigned long INLINE_BITS = INLINE_WORDS * 64;
+
     bit_vector(unsigned long size = 0);
     bit_vector(const bit_vector& other);
+    bit_vector(bit_vector&& other) noexcept;
     ~bit_vector();
 
+    bit_vector& operator = (const bit_vector& other);
+    bit_vector& operator = (bit_vector&& other) noexcept;
+
+    unsigned long length() const { return size; }
+
     void reset();
+    void init(bool value);
 
     bool get(unsigned long index) const;
     void set(unsigned long index, bool value = true);
+    // set [begin, end) to value
+    void set_range(unsigned long begin, unsigned long end, bool value = true);
+
+    unsigned long count() const;
+    bool any() const;
+    bool operator == (const bit_vector& other) const;
+    bool operator != (const bit_vector& other) const
+    {
+        return !(*this == other);
+    }
+
+    // The first set bit at or after index, or length() if there isn't one.
+    unsigned long find_next(unsigned long index) const;
+    unsigned long find_first() const { return find_next(0); }
+    // number of set bits before index
+    unsigned long rank(unsigned long index) const;
+    // index of the nth (from 0) set bit, or length() if there aren't n + 1
+    unsigned long select(unsigned long n) const;
+
+    // Call f(i) for each set bit i, in order.
+    template <class F> void for_each_set(F f) const
+    {
+        for (int w = 0; w < nwords; ++w)
+            for (uint64_t bits = data[w]; bits; bits &= bits - 1)
+                f(w * 64UL + __builtin_ctzll(bits));
+    }
 
     bit_vector& operator |= (const bit_vector& other);
     bit_vector& operator &= (const bit_vector& other);
+    bit_vector& operator ^= (const bit_vector& other);
+    // clear the bits which are set in other
+    bit_vector& and_not(const bit_vector& other);
     bit_vector  operator & (const bit_vector& other) const;
+    bit_vector  operator | (const bit_vector& other) const;
+    bit_vector  operator ^ (const bit_vector& other) const;
+
+    // this = a op b, reusing this vector's storage
+    void assign_and(const bit_vector& a, const bit_vector& b);
+    void assign_or(const bit_vector& a, const bit_vector& b);
+    void assign_xor(const bit_vector& a, const bit_vector& b);
+    void assign_and_not(const bit_vector& a, const bit_vector& b);
+    // this |= a & b
+    void or_and(const bit_vector& a, const bit_vector& b);
+
+    // move bits towards higher (<<=) or lower (>>=) indices, dropping any
+    // which fall off the end
+    bit_vector& operator <<= (unsigned long shift);
+    bit_vector& operator >>= (unsigned long shift);
 
 protected:
+    void allocate(unsigned long new_size);
+    void clear_tail();
+
     unsigned long size;
     int nwords;
-    unsigned long *data;
+    uint64_t *data;
+    uint64_t inline_data[INLINE_WORDS];
 };
 
 #define LONGSIZE (sizeof(unsigned long)*8)
@@ -39,18 +102,30 @@ protected:
 #define ULONG_MAX ((unsigned long)(-1))
 #endif
 
+// Stored as 64-bit words (rather than a bitset) so that the set bits can be
+// visited a word at a time.
 template <unsigned int SIZE> class FixedBitVector
 {
 protected:
-    bitset<SIZE> data;
+    static constexpr unsigned int NWORDS = (SIZE + 63) / 64;
+    uint64_t words[NWORDS];
+
+    // the bits of the last word which are in use
+    static constexpr uint64_t last_word_mask()
+    {
+        return SIZE % 64 ? (uint64_t(1) << (SIZE % 64)) - 1 : ~uint64_t(0);
+    }
+
 public:
     void reset()
     {
-        data.reset();
+        for (uint64_t &w : words)
+            w = 0;
     }
 
     FixedBitVector()
     {
+        reset();
     }
 
     inline bool get(unsigned int i) const
@@ -60,7 +135,7 @@ public:
         if (i >= SIZE)
             die("bit vector range error: %d / %u", (int)i, SIZE);
 #endif
-        return data[i];
+        return words[i / 64] >> (i % 64) & 1;
     }
 
     inline bool operator[](unsigned int i) const
@@ -74,36 +149,177 @@ public:
         if (i >= SIZE)
             die("bit vector range error: %d / %u", (int)i, SIZE);
 #endif
-        data[i] = value;
+        const uint64_t bit = uint64_t(1) << (i % 64);
+        if (value)
+            words[i / 64] |= bit;
+        else
+            words[i / 64] &= ~bit;
     }
 
     inline unsigned int count() const
     {
-        return data.count();
+        unsigned int n = 0;
+        for (uint64_t w : words)
+            n += __builtin_popcountll(w);
+        return n;
     }
 
     inline bool any() const
     {
-        return data.any();
+        for (uint64_t w : words)
+            if (w)
+                return true;
+        return false;
+    }
+
+    // The bits as 64-bit words, for packing them elsewhere.
+    static constexpr unsigned int num_words() { return NWORDS; }
+
+    inline uint64_t get_word(unsigned int w) const
+    {
+        return words[w];
+    }
+
+    inline void set_word(unsigned int w, uint64_t bits)
+    {
+        words[w] = w == NWORDS - 1 ? bits & last_word_mask() : bits;
+    }
+
+    inline bool operator==(const FixedBitVector<SIZE> &x) const
+    {
+        for (unsigned int i = 0; i < NWORDS; i++)
+            if (words[i] != x.words[i])
+                return false;
+        return true;
+    }
+
+    inline bool operator!=(const FixedBitVector<SIZE> &x) const
+    {
+        return !(*this == x);
+    }
+
+    // Is any bit set in both?
+    inline bool intersects(const FixedBitVector<SIZE> &x) const
+    {
+        for (unsigned int i = 0; i < NWORDS; i++)
+            if (words[i] & x.words[i])
+                return true;
+        return false;
+    }
+
+    // Is every bit of x set here too?
+    inline bool contains_all(const FixedBitVector<SIZE> &x) const
+    {
+        for (unsigned int i = 0; i < NWORDS; i++)
+            if (x.words[i] & ~words[i])
+                return false;
+        return true;
+    }
+
+    // The first set bit at or after i, or SIZE if there isn't one.
+    unsigned int find_next(unsigned int i) const
+    {
+        if (i >= SIZE)
+            return SIZE;
+        unsigned int w = i / 64;
+        uint64_t bits = words[w] & (~uint64_t(0) << (i % 64));
+        while (!bits)
+        {
+            if (++w == NWORDS)
+                return SIZE;
+            bits = words[w];
+        }
+        return w * 64 + __builtin_ctzll(bits);
+    }
+
+    unsigned int find_first() const
+    {
+        return find_next(0);
+    }
+
+    // Call f(i) for each set bit i, in order.
+    template <class F> void for_each_set(F f) const
+    {
+        for (unsigned int w = 0; w < NWORDS; w++)
+        {
+            for (uint64_t bits = words[w]; bits; bits &= bits - 1)
+                f(w * 64 + __builtin_ctzll(bits));
+        }
+    }
+
+    // for (unsigned int i : bits.set_bits())
+    class set_bit_iterator
+    {
+    public:
+        set_bit_iterator(const FixedBitVector<SIZE> *v, unsigned int i)
+            : vec(v), index(i)
+        {
+        }
+        unsigned int operator*() const { return index; }
+        set_bit_iterator &operator++()
+        {
+            index = vec->find_next(index + 1);
+            return *this;
+        }
+        bool operator!=(const set_bit_iterator &other) const
+        {
+            return index != other.index;
+        }
+    private:
+        const FixedBitVector<SIZE> *vec;
+        unsigned int index;
+    };
+
+    struct set_bit_range
+    {
+        const FixedBitVector<SIZE> *vec;
+        set_bit_iterator begin() const
+        {
+            return set_bit_iterator(vec, vec->find_first());
+        }
+        set_bit_iterator end() const { return set_bit_iterator(vec, SIZE); }
+    };
+
+    set_bit_range set_bits() const
+    {
+        return set_bit_range{this};
     }
 
     inline FixedBitVector<SIZE>& operator|=(const FixedBitVector<SIZE>&x)
     {
-        data |= x.data;
+        for (unsigned int i = 0; i < NWORDS; i++)
+            words[i] |= x.words[i];
         return *this;
     }
 
     inline FixedBitVector<SIZE>& operator&=(const FixedBitVector<SIZE>&x)
     {
-        data &= x.data;
+        for (unsigned int i = 0; i < NWORDS; i++)
+            words[i] &= x.words[i];
         return *this;
     }
 
+    inline FixedBitVector<SIZE> operator&(const FixedBitVector<SIZE>&x) const
+    {
+        FixedBitVector<SIZE> res = *this;
+        return res &= x;
+    }
+
     void init(bool value)
     {
-        data.reset();
+        for (uint64_t &w : words)
+            w = value ? ~uint64_t(0) : 0;
         if (value)
-            data.flip();
+            words[NWORDS - 1] &= last_word_mask();
+    }
+
+    // A mask with just the given bits set, e.g. mask({MB_CONFUSED, MB_MAD}).
+    static FixedBitVector<SIZE> mask(std::initializer_list<unsigned int> bits)
+    {
+        FixedBitVector<SIZE> res;
+        for (unsigned int i : bits)
+            res.set(i);
+        return res;
     }
 };
 
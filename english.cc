@@ -8,10 +8,13 @@
 #include "defines.h"
 #include "english.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cwctype>
 #include <string>
+#include <unordered_map>
 
+#include "number-words.h"
 #include "stringutil.h"
 
 const char * const standard_plural_qualifiers[] =
@@ -25,10 +28,245 @@ bool is_vowel(const char32_t chr)
     return low == 'a' || low == 'e' || low == 'i' || low == 'o' || low == 'u';
 }
 
+// For monster names ending with these suffixes, we pluralise directly without
+// attempting to use the "of" rule. For instance:
+//
+//      moth of wrath           => moths of wrath but
+//      moth of wrath zombie    => moth of wrath zombies.
+static const char * const _monster_suffixes[] =
+{
+    "zombie", "skeleton", "simulacrum", nullptr
+};
+
+// The rules for pluralising a word, by ending. The first rule that matches
+// wins; anything else gets -s. This'll need to be updated for correctness
+// whenever new monsters/items are added.
+struct plural_rule
+{
+    const char *ending;
+    bool whole_word;        // ending must be the whole word
+    unsigned char strip;    // remove this many bytes
+    const char *append;     // and then add this
+};
+
+static const plural_rule _plural_rules[] =
+{
+    { "lotus",      false, 0, "es" },
+    { "status",     false, 0, "es" },
+    // Fungus, ufetubus, for instance.
+    { "us",         false, 2, "i" },
+    { "larva",      false, 0, "e" },
+    { "antenna",    false, 0, "e" },
+    { "hypha",      false, 0, "e" },
+    // Vortex; vortexes is legal, but the classic plural is cooler.
+    { "ex",         false, 2, "ices" },
+    { "mosquito",   false, 0, "es" },
+    { "ss",         false, 0, "es" },
+    { "cyclops",    false, 1, "es" },
+    { "catoblepas", true,  1, "e" },
+    { "s",          false, 0, "" },
+    { "y",          true,  0, "s" },
+    // day -> days, boy -> boys, etc
+    { "ay",         false, 0, "s" },
+    { "ey",         false, 0, "s" },
+    { "iy",         false, 0, "s" },
+    { "oy",         false, 0, "s" },
+    { "uy",         false, 0, "s" },
+    { "Ay",         false, 0, "s" },
+    { "Ey",         false, 0, "s" },
+    { "Iy",         false, 0, "s" },
+    { "Oy",         false, 0, "s" },
+    { "Uy",         false, 0, "s" },
+    // jelly -> jellies
+    { "y",          false, 1, "ies" },
+    // knife -> knives
+    { "fe",         false, 2, "ves" },
+    // staff -> staves
+    { "staff",      false, 2, "ves" },
+    // elf -> elves, but not hippogriff -> hippogrives.
+    // TODO: if someone defines a "goblin chief", this should be revisited.
+    { "ff",         false, 0, "s" },
+    { "f",          false, 1, "ves" },
+    // mage -> magi
+    { "mage",       false, 1, "i" },
+    { "gold",       true,  0, "" },
+    { "fish",       false, 0, "" },
+    { "folk",       false, 0, "" },
+    { "spawn",      false, 0, "" },
+    { "tengu",      false, 0, "" },
+    { "sheep",      false, 0, "" },
+    { "swine",      false, 0, "" },
+    { "efreet",     false, 0, "" },
+    { "jiangshi",   false, 0, "" },
+    { "raiju",      false, 0, "" },
+    { "meliai",     false, 0, "" },
+    // To handle cockroaches, sphinxes, and bushes.
+    { "ch",         false, 0, "es" },
+    { "sh",         false, 0, "es" },
+    { "x",          false, 0, "es" },
+    // simulacrum -> simulacra (correct Latin pluralisation)
+    // also eidolon -> eidola (correct Greek pluralisation)
+    { "simulacrum", false, 2, "a" },
+    { "eidolon",    false, 2, "a" },
+    // djinni -> djinn.
+    { "djinni",     false, 1, "" },
+    { "foot",       true,  3, "eet" },
+    // Unlike "angel" which is fully assimilated, and "cherub" and "seraph"
+    // which may be pluralised both ways, "ophan" always uses Hebrew
+    // pluralisation.
+    { "ophan",      true,  0, "im" },
+    { "cherub",     true,  0, "im" },
+    { "seraph",     true,  0, "im" },
+    // Barachi -> Barachim. Kind of Hebrew? Kind of goofy.
+    // (not sure if this is ever used...)
+    { "arachi",     false, 0, "m" },
+    // ushabti -> ushabtiu (correct ancient Egyptian pluralisation)
+    { "ushabti",    true,  0, "u" },
+    // Tzitzimitl -> Tzitzimimeh (correct Nahuatl pluralisation)
+    { "Tzitzimitl", true,  2, "meh" },
+};
+
+// The rules compiled into a trie of reversed endings, so a word is
+// classified by one pass backwards over its last few bytes.
+class plural_trie
+{
+public:
+    plural_trie()
+    {
+        m_nodes.emplace_back();
+        for (int i = 0; i < (int)ARRAYSZ(_plural_rules); i++)
+        {
+            const plural_rule &rule = _plural_rules[i];
+            int n = 0;
+            for (int j = strlen(rule.ending) - 1; j >= 0; j--)
+                n = _add_child(n, rule.ending[j]);
+
+            int &slot = rule.whole_word ? m_nodes[n].whole_rule
+                                        : m_nodes[n].rule;
+            // the first rule for an ending wins
+            if (slot < 0)
+                slot = i;
+        }
+    }
+
+    // returns null if no rule matches
+    const plural_rule *match(const string &word) const
+    {
+        int best = -1;
+        int n = 0;
+        for (size_t pos = word.length(); pos > 0; pos--)
+        {
+            n = _child(n, word[pos - 1]);
+            if (n < 0)
+                break;
+
+            const node &nd = m_nodes[n];
+            if (nd.rule >= 0 && (best < 0 || nd.rule < best))
+                best = nd.rule;
+            if (pos == 1 && nd.whole_rule >= 0
+                && (best < 0 || nd.whole_rule < best))
+            {
+                best = nd.whole_rule;
+            }
+        }
+        return best < 0 ? nullptr : &_plural_rules[best];
+    }
+
+private:
+    struct node
+    {
+        // (byte, node), sorted by byte
+        vector<pair<char, int>> children;
+        int rule = -1;
+        int whole_rule = -1;
+    };
+
+    int _child(int n, char c) const
+    {
+        for (const auto &edge : m_nodes[n].children)
+            if (edge.first == c)
+                return edge.second;
+        return -1;
+    }
+
+    int _add_child(int n, char c)
+    {
+        const int existing = _child(n, c);
+        if (existing >= 0)
+            return existing;
+
+        m_nodes.emplace_back();
+        const int added = m_nodes.size() - 1;
+        auto &children = m_nodes[n].children;
+        children.insert(lower_bound(children.begin(), children.end(),
+                                    make_pair(c, 0)),
+                        make_pair(c, added));
+        return added;
+    }
+
+    vector<node> m_nodes;
+};
+
+string pluralise_word(const string &word)
+{
+    static const plural_trie rules;
+
+    const plural_rule *rule = rules.match(word);
+    if (!rule)
+        return word + "s";
+    return word.substr(0, word.length() - rule->strip) + rule->append;
+}
+
+// The same names get pluralised, articled and apostrophised over and over,
+// so remember the results. (Per thread, so no locking; and forgetful, so
+// an endless stream of different names doesn't use endless memory.)
+typedef unordered_map<string, string> morphology_cache;
+static const size_t MORPHOLOGY_CACHE_SIZE = 4096;
+
+template <class F>
+static string _memoize(morphology_cache &cache, const string &name, F make)
+{
+    if (const string *known = map_find(cache, name))
+        return *known;
+
+    // (make may recurse, and so use the cache itself)
+    string made = make(name);
+    if (cache.size() >= MORPHOLOGY_CACHE_SIZE)
+        cache.clear();
+    cache[name] = made;
+    return made;
+}
+
+static string _pluralise(const string &name, const char * const qualifiers[],
+                         const char * const no_qualifier[]);
+
 // Pluralises a monster or item name. This'll need to be updated for
 // correctness whenever new monsters/items are added.
 string pluralise(const string &name, const char * const qualifiers[],
                  const char * const no_qualifier[])
+{
+    static thread_local morphology_cache plurals;
+    static thread_local morphology_cache monster_plurals;
+
+    // only the standard tables are known not to change
+    morphology_cache *cache = nullptr;
+    if (qualifiers == standard_plural_qualifiers && !no_qualifier)
+        cache = &plurals;
+    else if (qualifiers == standard_plural_qualifiers
+             && no_qualifier == _monster_suffixes)
+    {
+        cache = &monster_plurals;
+    }
+
+    if (!cache)
+        return _pluralise(name, qualifiers, no_qualifier);
+
+    return _memoize(*cache, name, [=](const string &n)
+                    { return _pluralise(n, qualifiers, no_qualifier); });
+}
+
+static string _pluralise(const string &name, const char * const qualifiers[],
+                         const char * const no_qualifier[])
 {
     string::size_type pos;
 
@@ -54,135 +292,23 @@ string pluralise(const string &name, const char * const qualifiers[],
         return pluralise(name.substr(0, pos)) + name.substr(pos);
     }
 
-    if (ends_with(name, "us"))
-    {
-        if (ends_with(name, "lotus") || ends_with(name, "status"))
-            return name + "es";
-        else
-            // Fungus, ufetubus, for instance.
-            return name.substr(0, name.length() - 2) + "i";
-    }
-    else if (ends_with(name, "larva") || ends_with(name, "antenna")
-             || ends_with(name, "hypha"))
-    {
-        return name + "e";
-    }
-    else if (ends_with(name, "ex"))
-    {
-        // Vortex; vortexes is legal, but the classic plural is cooler.
-        return name.substr(0, name.length() - 2) + "ices";
-    }
-    else if (ends_with(name, "mosquito") || ends_with(name, "ss"))
-        return name + "es";
-    else if (ends_with(name, "cyclops"))
-        return name.substr(0, name.length() - 1) + "es";
-    else if (name == "catoblepas")
-        return "catoblepae";
-    else if (ends_with(name, "s"))
-        return name;
-    else if (ends_with(name, "y"))
-    {
-        if (name == "y")
-            return "ys";
-        // day -> days, boy -> boys, etc
-        else if (is_vowel(name[name.length() - 2]))
-            return name + "s";
-        // jelly -> jellies
-        else
-            return name.substr(0, name.length() - 1) + "ies";
-    }
-    else if (ends_with(name, "fe"))
-    {
-        // knife -> knives
-        return name.substr(0, name.length() - 2) + "ves";
-    }
-    else if (ends_with(name, "staff"))
-    {
-        // staff -> staves
-        return name.substr(0, name.length() - 2) + "ves";
-    }
-    else if (ends_with(name, "f") && !ends_with(name, "ff"))
-    {
-        // elf -> elves, but not hippogriff -> hippogrives.
-        // TODO: if someone defines a "goblin chief", this should be revisited.
-        return name.substr(0, name.length() - 1) + "ves";
-    }
-    else if (ends_with(name, "mage"))
-    {
-        // mage -> magi
-        return name.substr(0, name.length() - 1) + "i";
-    }
-    else if (name == "gold"                 || ends_with(name, "fish")
-             || ends_with(name, "folk")     || ends_with(name, "spawn")
-             || ends_with(name, "tengu")    || ends_with(name, "sheep")
-             || ends_with(name, "swine")    || ends_with(name, "efreet")
-             || ends_with(name, "jiangshi") || ends_with(name, "raiju")
-             || ends_with(name, "meliai"))
-    {
-        return name;
-    }
-    else if (ends_with(name, "ch") || ends_with(name, "sh")
-             || ends_with(name, "x"))
-    {
-        // To handle cockroaches, sphinxes, and bushes.
-        return name + "es";
-    }
-    else if (ends_with(name, "simulacrum") || ends_with(name, "eidolon"))
-    {
-        // simulacrum -> simulacra (correct Latin pluralisation)
-        // also eidolon -> eidola (correct Greek pluralisation)
-        return name.substr(0, name.length() - 2) + "a";
-    }
-    else if (ends_with(name, "djinni"))
-    {
-        // djinni -> djinn.
-        return name.substr(0, name.length() - 1);
-    }
-    else if (name == "foot")
-        return "feet";
-    else if (name == "ophan" || name == "cherub" || name == "seraph")
-    {
-        // Unlike "angel" which is fully assimilated, and "cherub" and "seraph"
-        // which may be pluralised both ways, "ophan" always uses Hebrew
-        // pluralisation.
-        return name + "im";
-    }
-    else if (ends_with(name, "arachi"))
-    {
-        // Barachi -> Barachim. Kind of Hebrew? Kind of goofy.
-        // (not sure if this is ever used...)
-        return name + "m";
-    }
-    else if (name == "ushabti")
-    {
-        // ushabti -> ushabtiu (correct ancient Egyptian pluralisation)
-        return name + "u";
-    }
-    else if (name == "Tzitzimitl")
-    {
-        // Tzitzimitl -> Tzitzimimeh (correct Nahuatl pluralisation)
-        return name.substr(0, name.length() - 2) + "meh";
-    }
-
-    return name + "s";
+    return pluralise_word(name);
 }
 
-// For monster names ending with these suffixes, we pluralise directly without
-// attempting to use the "of" rule. For instance:
-//
-//      moth of wrath           => moths of wrath but
-//      moth of wrath zombie    => moth of wrath zombies.
-static const char * const _monster_suffixes[] =
-{
-    "zombie", "skeleton", "simulacrum", nullptr
-};
-
 string pluralise_monster(const string &name)
 {
     return pluralise(name, standard_plural_qualifiers, _monster_suffixes);
 }
 
+static string _apostrophise(const string &name);
+
 string apostrophise(const string &name)
+{
+    static thread_local morphology_cache possessives;
+    return _memoize(possessives, name, _apostrophise);
+}
+
+static string _apostrophise(const string &name)
 {
     if (name.empty())
         return name;
@@ -280,68 +406,9 @@ const char *decline_pronoun(gender_type gender, pronoun_type variant)
     return _pronoun_declension[gender][variant];
 }
 
-static string _tens_in_words(unsigned num)
-{
-    static const char *numbers[] =
-    {
-        "", "one", "two", "three", "four", "five", "six", "seven",
-        "eight", "nine", "ten", "eleven", "twelve", "thirteen", "fourteen",
-        "fifteen", "sixteen", "seventeen", "eighteen", "nineteen"
-    };
-    static const char *tens[] =
-    {
-        "", "", "twenty", "thirty", "forty", "fifty", "sixty", "seventy",
-        "eighty", "ninety"
-    };
-
-    if (num < 20)
-        return numbers[num];
-
-    int ten = num / 10, digit = num % 10;
-    return string(tens[ten]) + (digit ? string("-") + numbers[digit] : "");
-}
-
-static string _join_strings(const string &a, const string &b)
-{
-    if (!a.empty() && !b.empty())
-        return a + " " + b;
-
-    return a.empty() ? b : a;
-}
-
-static string _hundreds_in_words(unsigned num)
-{
-    unsigned dreds = num / 100, tens = num % 100;
-    string sdreds = dreds? _tens_in_words(dreds) + " hundred" : "";
-    string stens  = tens? _tens_in_words(tens) : "";
-    return _join_strings(sdreds, stens);
-}
-
-static string _number_in_words(unsigned num, unsigned period)
-{
-    static const char * const periods[] = {
-        "", " thousand", " million", " billion", " trillion"
-    };
-
-    ASSERT(period < ARRAYSZ(periods));
-
-    // Handle "eighteen million trillion", should unsigned go that high.
-    if (period == ARRAYSZ(periods) - 1)
-        return _number_in_words(num, 0) + periods[period];
-
-    unsigned thousands = num % 1000, rest = num / 1000;
-    if (!rest && !thousands)
-        return "zero";
-
-    return _join_strings((rest? _number_in_words(rest, period + 1) : ""),
-                        (thousands? _hundreds_in_words(thousands)
-                                    + periods[period]
-                                  : ""));
-}
-
 string number_in_words(unsigned num)
 {
-    return _number_in_words(num, 0);
+    return number_in_words(num, "en");
 }
 
 static string _number_to_string(unsigned number, bool in_words)
@@ -350,7 +417,17 @@ static string _number_to_string(unsigned number, bool in_words)
 }
 
 // Naively prefix A/an to a noun.
+static string _article_a(const string &name, bool lowercase);
+
 string article_a(const string &name, bool lowercase)
+{
+    static thread_local morphology_cache lower_articled;
+    static thread_local morphology_cache upper_articled;
+    return _memoize(lowercase ? lower_articled : upper_articled, name,
+                    [=](const string &n) { return _article_a(n, lowercase); });
+}
+
+static string _article_a(const string &name, bool lowercase)
 {
     if (!name.length())
         return name;
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "description-level-type.h"
 #include "enum.h"
 #include "gender-type.h"
 #include "pronoun-type.h"
@@ -21,10 +22,14 @@ string pluralise(const string &name,
                      = standard_plural_qualifiers,
                  const char * const no_of[] = nullptr);
 string pluralise_monster(const string &name);
+// just the rules for the ending, without looking for qualifiers or caching
+string pluralise_word(const string &word);
 string apostrophise(const string &name);
 string conjugate_verb(const string &verb, bool plural);
 const char *decline_pronoun(gender_type gender, pronoun_type variant);
 
+// English, since names are put together in English and translated later
+// (number-words.h has other languages)
 string number_in_words(unsigned number);
 
 string article_a(const string &name, bool lowercase = true);
@@ -0,0 +1,107 @@
+/*
+ * fixedarray-test.cc
+ * Check the FixedArray storage layouts and bulk operations
+ */
+
+#include <iostream>
+#include <set>
+#include <string>
+
+#include "AppHdr.h"
+#include "fixedarray.h"
+#include "test-util.h"
+
+using namespace std;
+
+struct test_coord
+{
+    int x, y;
+};
+
+// Every cell has its own storage slot, and the helpers agree with
+// operator().
+template <class LAYOUT>
+static void _check_layout(const string &name)
+{
+    const int W = 13, H = 10;
+    typedef FixedArray<int, W, H, LAYOUT> grid;
+    grid a(-1);
+
+    set<int> slots;
+    for (int x = 0; x < W; x++)
+        for (int y = 0; y < H; y++)
+        {
+            slots.insert(LAYOUT::index(x, y, W, H));
+            a[x][y] = x * 100 + y;
+        }
+    check_result(name + " slots", to_string(W * H), to_string(slots.size()));
+    check_result(name + " storage", "true",
+                 *slots.rbegin() < grid::STORAGE ? "true" : "false");
+
+    int mismatches = 0, cells = 0;
+    a.for_each([&](int x, int y, int &cell)
+               {
+                   cells++;
+                   if (cell != x * 100 + y || a(test_coord{x, y}) != cell)
+                       mismatches++;
+               });
+    check_result(name + " for_each", "0 " + to_string(W * H),
+                 to_string(mismatches) + " " + to_string(cells));
+
+    // corner neighbourhood is clipped
+    int sum = 0;
+    cells = 0;
+    a.for_each_neighbour(test_coord{0, H - 1}, 2, [&](int, int, int &cell)
+                         {
+                             cells++;
+                             sum += cell;
+                         });
+    check_result(name + " neighbours",
+                 "9 " + to_string(3 * (0 + 100 + 200) + 3 * (7 + 8 + 9)),
+                 to_string(cells) + " " + to_string(sum));
+
+    a.fill(test_coord{2, 3}, test_coord{4, 5}, -7);
+    cells = 0;
+    a.for_each([&](int, int, int &cell) { cells += cell == -7; });
+    check_result(name + " fill", "9", to_string(cells));
+
+    // copying between layouts
+    FixedArray<int, W, H> b(0);
+    b.copy(a);
+    FixedArray<int, W, H, LAYOUT> c(0);
+    c.copy(b, test_coord{1, 1}, test_coord{W - 1, H - 1});
+    mismatches = 0;
+    for (int x = 0; x < W; x++)
+        for (int y = 0; y < H; y++)
+        {
+            if (b[x][y] != a[x][y]
+                || c[x][y] != (x && y ? a[x][y] : 0))
+            {
+                mismatches++;
+            }
+        }
+    check_result(name + " copy", "0", to_string(mismatches));
+}
+
+int main()
+{
+    _check_layout<column_major_layout>("column major");
+    _check_layout<row_major_layout>("row major");
+    _check_layout<tiled_layout<4>>("tiled");
+    _check_layout<morton_layout>("morton");
+
+    check_result("morton storage", "12408",
+                 to_string(morton_layout::storage_size(80, 70)));
+
+    SquareArray<int, 3, tiled_layout<>> square(0);
+    square(test_coord{-3, 3}) = 5;
+    int sum = 0;
+    square.for_each_neighbour(test_coord{-2, 2}, 1,
+                              [&](int x, int y, int &cell)
+                              {
+                                  sum += cell * (x == -3 && y == 3);
+                              });
+    check_result("square array", "5", to_string(sum));
+
+    return 0;
+}
@@ -6,10 +6,167 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <type_traits>
 
 #include "fixedvector.h"
 
-template <class TYPE, int WIDTH, int HEIGHT> class FixedArray
+// Storage layouts for FixedArray: where cell (x, y) of a width x height
+// array lives in the flat storage, how much storage that needs, and
+// walk(), which calls f(x, y, index) for every cell of an inclusive
+// rectangle in an order that suits the layout.
+
+// Each column contiguous. The default, and the layout FixedArray always
+// had, so grid[x][y] loops with y innermost are the fast ones.
+struct column_major_layout
+{
+    static constexpr int storage_size(int width, int height)
+    {
+        return width * height;
+    }
+
+    static constexpr int index(int x, int y, int /*width*/, int height)
+    {
+        return x * height + y;
+    }
+
+    template <class F>
+    static void walk(int x0, int y0, int x1, int y1, int width, int height,
+                     F f)
+    {
+        for (int x = x0; x <= x1; x++)
+        {
+            int i = index(x, y0, width, height);
+            for (int y = y0; y <= y1; y++, i++)
+                f(x, y, i);
+        }
+    }
+};
+
+// Each row contiguous, for code that scans x innermost.
+struct row_major_layout
+{
+    static constexpr int storage_size(int width, int height)
+    {
+        return width * height;
+    }
+
+    static constexpr int index(int x, int y, int width, int /*height*/)
+    {
+        return y * width + x;
+    }
+
+    template <class F>
+    static void walk(int x0, int y0, int x1, int y1, int width, int height,
+                     F f)
+    {
+        for (int y = y0; y <= y1; y++)
+        {
+            int i = index(x0, y, width, height);
+            for (int x = x0; x <= x1; x++, i++)
+                f(x, y, i);
+        }
+    }
+};
+
+// Square blocks of TILE x TILE cells, each row major and stored in row
+// major order of blocks, so a radius 1 or 2 neighbourhood touches at most
+// four small blocks rather than 3-5 rows or columns a whole grid apart.
+// TILE must be a power of two; both dimensions are padded to a multiple
+// of it.
+template <int TILE = 8>
+struct tiled_layout
+{
+    static_assert(TILE > 0 && (TILE & (TILE - 1)) == 0,
+                  "tile size must be a power of two");
+
+    static constexpr int tiles(int cells)
+    {
+        return (cells + TILE - 1) / TILE;
+    }
+
+    static constexpr int storage_size(int width, int height)
+    {
+        return tiles(width) * tiles(height) * TILE * TILE;
+    }
+
+    static constexpr int index(int x, int y, int width, int /*height*/)
+    {
+        return ((y / TILE) * tiles(width) + x / TILE) * TILE * TILE
+               + (y % TILE) * TILE + x % TILE;
+    }
+
+    template <class F>
+    static void walk(int x0, int y0, int x1, int y1, int width, int height,
+                     F f)
+    {
+        for (int ty = y0 / TILE; ty <= y1 / TILE; ty++)
+        {
+            const int ty0 = std::max(y0, ty * TILE);
+            const int ty1 = std::min(y1, ty * TILE + TILE - 1);
+            for (int tx = x0 / TILE; tx <= x1 / TILE; tx++)
+            {
+                const int tx0 = std::max(x0, tx * TILE);
+                const int tx1 = std::min(x1, tx * TILE + TILE - 1);
+                for (int y = ty0; y <= ty1; y++)
+                {
+                    int i = index(tx0, y, width, height);
+                    for (int x = tx0; x <= tx1; x++, i++)
+                        f(x, y, i);
+                }
+            }
+        }
+    }
+};
+
+// Z-order (Morton): the bits of x and y interleaved, so cells close
+// together in both directions are close in memory at every scale. Sizes
+// that aren't powers of two leave gaps: an 80x70 grid needs 12408 cells.
+struct morton_layout
+{
+    // 0000abcd -> 0a0b0c0d (for 16 bit coordinates)
+    static constexpr uint32_t spread(uint32_t v)
+    {
+        v &= 0xffff;
+        v = (v | v << 8) & 0x00ff00ff;
+        v = (v | v << 4) & 0x0f0f0f0f;
+        v = (v | v << 2) & 0x33333333;
+        v = (v | v << 1) & 0x55555555;
+        return v;
+    }
+
+    static constexpr int index(int x, int y, int /*width*/, int /*height*/)
+    {
+        return spread(x) | spread(y) << 1;
+    }
+
+    // index() grows with both x and y, so the last cell is the furthest
+    static constexpr int storage_size(int width, int height)
+    {
+        return width && height ? index(width - 1, height - 1, 0, 0) + 1 : 0;
+    }
+
+    template <class F>
+    static void walk(int x0, int y0, int x1, int y1, int /*width*/,
+                     int /*height*/, F f)
+    {
+        for (int y = y0; y <= y1; y++)
+        {
+            const uint32_t yi = spread(y) << 1;
+            uint32_t xi = spread(x0);
+            for (int x = x0; x <= x1; x++)
+            {
+                f(x, y, xi | yi);
+                // add 1 to the x bits only, carrying across the y bits
+                xi = ((xi | 0xaaaaaaaa) + 1) & 0x55555555;
+            }
+        }
+    }
+};
+
+template <class TYPE, int WIDTH, int HEIGHT,
+          class LAYOUT = column_major_layout>
+class FixedArray
 {
 public:
     typedef TYPE            value_type;
@@ -21,9 +178,26 @@ public:
     typedef unsigned long   size_type;
     typedef long            difference_type;
 
-    // operator[] should return one of these to avoid breaking
-    // client code (if inlining is on there won't be a speed hit)
-    typedef FixedVector<TYPE, HEIGHT> Column;
+    typedef LAYOUT          layout;
+    static constexpr int STORAGE = LAYOUT::storage_size(WIDTH, HEIGHT);
+
+    // operator[] returns one of these to avoid breaking client code
+    // (if inlining is on there won't be a speed hit)
+    template <class ARRAY, class REF>
+    class column_ref
+    {
+    public:
+        column_ref(ARRAY &a, unsigned long col) : array(a), x(col) {}
+
+        REF operator[](unsigned long y) const { return array.at(x, y); }
+        size_t size() const { return HEIGHT; }
+
+    private:
+        ARRAY &array;
+        unsigned long x;
+    };
+    typedef column_ref<FixedArray, TYPE&> Column;
+    typedef column_ref<const FixedArray, const TYPE&> ConstColumn;
 
 public:
     ~FixedArray()                           {}
@@ -43,48 +217,180 @@ public:
     int height() const { return HEIGHT; }
 
     // ----- Access -----
-    Column& operator[](unsigned long index) { return mData[index]; }
-    const Column& operator[](unsigned long index) const
+    Column operator[](unsigned long index) { return Column(*this, index); }
+    ConstColumn operator[](unsigned long index) const
     {
-        return mData[index];
+        return ConstColumn(*this, index);
     }
 
     template<class Indexer>
     TYPE& operator () (const Indexer &i)
     {
-        return mData[i.x][i.y];
+        return at(i.x, i.y);
     }
 
     template<class First, class Second>
     TYPE& operator () (const pair<First,Second> &p)
     {
-        return mData[p.first][p.second];
+        return at(p.first, p.second);
     }
 
     template<class Indexer>
     const TYPE& operator () (const Indexer &i) const
     {
-        return mData[i.x][i.y];
+        return at(i.x, i.y);
     }
 
     template<class First, class Second>
     const TYPE& operator () (const pair<First,Second> &p) const
     {
-        return mData[p.first][p.second];
+        return at(p.first, p.second);
+    }
+
+    TYPE& at(unsigned long x, unsigned long y)
+    {
+        return mData[_index(x, y)];
     }
 
+    const TYPE& at(unsigned long x, unsigned long y) const
+    {
+        return mData[_index(x, y)];
+    }
+
+    // ----- Bulk operations -----
+    // These go through the cells in storage order, not x then y.
+
     void init(const TYPE& def)
     {
-        for (auto &col : mData)
-            col.init(def);
+        std::fill(mData.begin(), mData.end(), def);
+    }
+
+    // Set every cell from tl to br, inclusive.
+    template<class Indexer>
+    void fill(const Indexer &tl, const Indexer &br, const TYPE& value)
+    {
+        for_each(tl, br, [&value](int, int, TYPE &cell) { cell = value; });
+    }
+
+    // Copy every cell of other, whatever its layout.
+    template<class OTHER_LAYOUT>
+    void copy(const FixedArray<TYPE, WIDTH, HEIGHT, OTHER_LAYOUT> &other)
+    {
+        if constexpr (std::is_same<LAYOUT, OTHER_LAYOUT>::value)
+            mData = other.mData;
+        else
+            _copy(other, 0, 0, WIDTH - 1, HEIGHT - 1);
+    }
+
+    // Copy the cells from tl to br, inclusive, of other.
+    template<class OTHER_LAYOUT, class Indexer>
+    void copy(const FixedArray<TYPE, WIDTH, HEIGHT, OTHER_LAYOUT> &other,
+              const Indexer &tl, const Indexer &br)
+    {
+        _copy(other, tl.x, tl.y, br.x, br.y);
+    }
+
+    // f(x, y, cell) for every cell.
+    template<class F>
+    void for_each(F f)
+    {
+        _walk(0, 0, WIDTH - 1, HEIGHT - 1, f);
+    }
+
+    template<class F>
+    void for_each(F f) const
+    {
+        _walk(0, 0, WIDTH - 1, HEIGHT - 1, f);
+    }
+
+    // f(x, y, cell) for every cell from tl to br, inclusive.
+    template<class Indexer, class F>
+    void for_each(const Indexer &tl, const Indexer &br, F f)
+    {
+        _walk(tl.x, tl.y, br.x, br.y, f);
+    }
+
+    template<class Indexer, class F>
+    void for_each(const Indexer &tl, const Indexer &br, F f) const
+    {
+        _walk(tl.x, tl.y, br.x, br.y, f);
+    }
+
+    // f(x, y, cell) for every cell within radius (Chebyshev distance) of
+    // c, including c itself, clipped to the array.
+    template<class Indexer, class F>
+    void for_each_neighbour(const Indexer &c, int radius, F f)
+    {
+        _walk_clipped(c.x - radius, c.y - radius, c.x + radius, c.y + radius,
+                      f);
+    }
+
+    template<class Indexer, class F>
+    void for_each_neighbour(const Indexer &c, int radius, F f) const
+    {
+        _walk_clipped(c.x - radius, c.y - radius, c.x + radius, c.y + radius,
+                      f);
+    }
+
+private:
+    template<class OTHER_LAYOUT>
+    void _copy(const FixedArray<TYPE, WIDTH, HEIGHT, OTHER_LAYOUT> &other,
+               int x0, int y0, int x1, int y1)
+    {
+        _walk(x0, y0, x1, y1,
+              [&other](int x, int y, TYPE &cell) { cell = other.at(x, y); });
+    }
+
+    static int _index(unsigned long x, unsigned long y)
+    {
+#ifdef ASSERTS
+        if (x >= WIDTH || y >= HEIGHT)
+        {
+            // printed as signed, as in FixedVector
+            die_noline("range check error (%ld, %ld / %d, %d)",
+                       (signed long)x, (signed long)y, WIDTH, HEIGHT);
+        }
+#endif
+        return LAYOUT::index(x, y, WIDTH, HEIGHT);
+    }
+
+    template<class F>
+    void _walk(int x0, int y0, int x1, int y1, F f)
+    {
+        TYPE *data = mData.buffer();
+        LAYOUT::walk(x0, y0, x1, y1, WIDTH, HEIGHT,
+                     [data, &f](int x, int y, int i) { f(x, y, data[i]); });
+    }
+
+    template<class F>
+    void _walk(int x0, int y0, int x1, int y1, F f) const
+    {
+        const TYPE *data = mData.buffer();
+        LAYOUT::walk(x0, y0, x1, y1, WIDTH, HEIGHT,
+                     [data, &f](int x, int y, int i) { f(x, y, data[i]); });
+    }
+
+    template<class F>
+    void _walk_clipped(int x0, int y0, int x1, int y1, F f)
+    {
+        _walk(std::max(x0, 0), std::max(y0, 0), std::min(x1, WIDTH - 1),
+              std::min(y1, HEIGHT - 1), f);
+    }
+
+    template<class F>
+    void _walk_clipped(int x0, int y0, int x1, int y1, F f) const
+    {
+        _walk(std::max(x0, 0), std::max(y0, 0), std::min(x1, WIDTH - 1),
+              std::min(y1, HEIGHT - 1), f);
     }
 
 protected:
-    FixedVector<Column, WIDTH> mData;
+    FixedVector<TYPE, STORAGE> mData;
 };
 
 // A fixed array centered around the origin.
-template <class TYPE, int RADIUS> class SquareArray
+template <class TYPE, int RADIUS, class LAYOUT = column_major_layout>
+class SquareArray
 {
 public:
     typedef TYPE            value_type;
@@ -116,12 +422,12 @@ public:
     // ----- Access -----
     template<class Indexer> TYPE& operator () (const Indexer &i)
     {
-        return data[i.x+RADIUS][i.y+RADIUS];
+        return data.at(i.x+RADIUS, i.y+RADIUS);
     }
 
     template<class Indexer> const TYPE& operator () (const Indexer &i) const
     {
-        return data[i.x+RADIUS][i.y+RADIUS];
+        return data.at(i.x+RADIUS, i.y+RADIUS);
     }
 
     void init(const TYPE& def)
@@ -129,6 +435,29 @@ public:
         data.init(def);
     }
 
+    // f(x, y, cell) for every cell within radius of c, relative to the
+    // origin like operator().
+    template<class Indexer, class F>
+    void for_each_neighbour(const Indexer &c, int radius, F f)
+    {
+        data.for_each_neighbour(_offset(c), radius,
+                                [&f](int x, int y, TYPE &cell)
+                                {
+                                    f(x - RADIUS, y - RADIUS, cell);
+                                });
+    }
+
+private:
+    struct offset_coord
+    {
+        int x, y;
+    };
+
+    template<class Indexer> static offset_coord _offset(const Indexer &i)
+    {
+        return { i.x + RADIUS, i.y + RADIUS };
+    }
+
 protected:
-    FixedArray<TYPE, 2*RADIUS+1, 2*RADIUS+1> data;
+    FixedArray<TYPE, 2*RADIUS+1, 2*RADIUS+1, LAYOUT> data;
 };
@@ -0,0 +1,552 @@
+/**
+ * @file
+ * @brief Functions dealing with the morphology of the German language.
+ *
+ * The rules here are the ones scripts/decline-de.py used to expand the
+ * monster names into every case and article offline.
+**/
+
+#include "AppHdr.h"
+#include "german.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#include "stringutil.h"
+#include "xlate.h"
+
+static const char * const case_names[NUM_GCASES] = { "nom", "akk", "dat" };
+
+// owns the strings a german_case_bundle views
+struct cached_bundle
+{
+    string singular[NUM_GCASES];
+    string plural[NUM_GCASES];
+    german_case_bundle views;
+};
+
+// bundles by language/domain/English/English plural
+// (nodes don't move, so the views stay valid as the map grows)
+static unordered_map<string, cached_bundle> bundle_cache;
+static mutex bundle_cache_lock;
+
+bool is_german(const string &lang)
+{
+    return lang == "de" || starts_with(lang, "de_");
+}
+
+// case-insensitive check for any of a list of endings
+static bool _ends_with_any(const string &s, const char * const endings[])
+{
+    const string lower = lowercase_string(s);
+    return ends_with(lower, endings) != 0;
+}
+
+string split_of(const string &text, string &suffix)
+{
+    static const char * const words[] = { " of ", " von ", " des ", " der " };
+
+    for (const char *patt : words)
+    {
+        // must follow a word (so "der Ork" isn't split)
+        for (size_t pos = text.find(patt); pos != string::npos;
+             pos = text.find(patt, pos + 1))
+        {
+            if (pos > 0 && text[pos - 1] != ' ')
+            {
+                suffix = text.substr(text.rfind(patt));
+                return text.substr(0, text.find(patt));
+            }
+        }
+    }
+
+    suffix.clear();
+    return text;
+}
+
+// articles by definiteness, gender and case
+static const char * const german_articles[2][4][NUM_GCASES] =
+{
+    {
+        // nom     akk      dat
+        { nullptr, nullptr, nullptr }, // unknown
+        { "ein",   "einen", "einem" }, // masculine
+        { "eine",  "eine",  "einer" }, // feminine
+        { "ein",   "ein",   "einem" }, // neuter
+    },
+    {
+        { nullptr, nullptr, nullptr },
+        { "der",   "den",   "dem"   },
+        { "die",   "die",   "der"   },
+        { "das",   "das",   "dem"   },
+    },
+};
+
+// adjective endings after the article, by definiteness, gender and case
+static const char * const german_adjective_endings[2][4][NUM_GCASES] =
+{
+    {
+        // nom  akk    dat
+        { "e",  "e",   "en" }, // unknown
+        { "er", "en",  "en" }, // masculine
+        { "e",  "e",   "en" }, // feminine
+        { "es", "es",  "en" }, // neuter
+    },
+    {
+        { "e",  "e",   "en" },
+        { "e",  "en",  "en" },
+        { "e",  "e",   "en" },
+        { "e",  "e",   "en" },
+    },
+};
+
+static grammatical_gender _get_gender(const string &text)
+{
+    for (int g = GRAM_MASCULINE; g <= GRAM_NEUTER; g++)
+    {
+        if (starts_with(text, string(german_articles[1][g][GCASE_NOM]) + " "))
+            return static_cast<grammatical_gender>(g);
+    }
+    return GRAM_GENDER_NONE;
+}
+
+// Does this masculine noun take the n-declension?
+static bool _is_weak(const string &phrase)
+{
+    static const char * const irregular[] = { "herr", "bauer", nullptr };
+    static const char * const strong_e[] =
+    {
+        "see", "käse", "deutsche", "zombie", "gargoyle", nullptr
+    };
+    static const char * const weak_en[] =
+    {
+        "at", "ant", "ent", "ist", "oph", "bär", "mensch", "prinz", "narr",
+        nullptr
+    };
+
+    if (_ends_with_any(phrase, irregular))
+        return true;
+    else if (ends_with(phrase, "e"))
+        return !_ends_with_any(phrase, strong_e);
+    else
+        return _ends_with_any(phrase, weak_en);
+}
+
+german_noun parse_german_noun(const string &nominative)
+{
+    german_noun noun;
+    noun.phrase = split_of(nominative, noun.suffix);
+    noun.features.gender = _get_gender(noun.phrase);
+    if (noun.features.gender == GRAM_MASCULINE && _is_weak(noun.phrase))
+        noun.features.noun_class = GERMAN_WEAK;
+    return noun;
+}
+
+// replace a leading article
+static bool _replace_article(string &s, const string &from, const string &to)
+{
+    if (!starts_with(s, from + " "))
+        return false;
+    s = to + s.substr(from.length());
+    return true;
+}
+
+string decline_german_singular(const german_noun &noun, bool definite,
+                               german_case gcase)
+{
+    const grammatical_gender gender = noun.features.get_gender();
+    string s = noun.phrase;
+
+    if (gender != GRAM_GENDER_NONE)
+    {
+        _replace_article(s, german_articles[1][gender][GCASE_NOM],
+                         german_articles[definite][gender][gcase]);
+    }
+
+    // adjective endings (the nominative with definite article has -e)
+    const string ending = german_adjective_endings[definite][gender][gcase];
+    if (ending != "e")
+        s = replace_all(s, "e ", ending + " ");
+
+    // n-declension of the noun itself
+    if (noun.features.noun_class == GERMAN_WEAK && gcase != GCASE_NOM)
+    {
+        static const char * const add_n[] = { "herr", "bauer", nullptr };
+        if (_ends_with_any(s, add_n) || ends_with(s, "e"))
+            s += "n";
+        else
+            s += "en";
+    }
+    else if (gcase == GCASE_DAT && gender == GRAM_NEUTER
+             && ends_with(lowercase_string(s), "herz"))
+    {
+        // a rare neuter noun that declines (in dative only)
+        s += "en";
+    }
+
+    return s + noun.suffix;
+}
+
+static bool _ends_with_char(const string &s, const char *chars)
+{
+    return !s.empty() && strchr(chars, s.back()) != nullptr;
+}
+
+// replace the last n bytes
+static string _replace_end(const string &s, size_t n, const string &repl)
+{
+    return s.substr(0, s.length() - n) + repl;
+}
+
+string decline_german_plural(const german_noun &noun, german_case gcase,
+                             bool &certain)
+{
+    static const char * const english_loans[] =
+    {
+        "zombie", "goblin", "wyvern", "spriggan", "klown", "gargoyle", nullptr
+    };
+    static const char * const unchanged[] = { "kolben", "schatten", nullptr };
+    static const char * const a_to_en[] =
+    {
+        "hydra", "prisma", "tarantella", nullptr
+    };
+    static const char * const add_e[] = { "eur", "ich", "ig", "ling", nullptr };
+    static const char * const maybe_add_e[] = { "ör", "är", "ar", nullptr };
+    static const char * const add_en[] = { "at", "ant", "ent", "ist", nullptr };
+    static const char * const fem_add_en[] =
+    {
+        "ung", "tion", "heit", "keit", "schaft", "tät", "ei", nullptr
+    };
+
+    const string &singular = noun.phrase;
+    const grammatical_gender gender = noun.features.get_gender();
+    certain = false;
+
+    string plural = singular;
+    if (gender != GRAM_GENDER_NONE)
+        _replace_article(plural, german_articles[1][gender][GCASE_NOM], "%d");
+
+    if (_ends_with_any(singular, english_loans) || ends_with(singular, "Lich"))
+    {
+        // borrowed English words take -s
+        plural += "s";
+        certain = true;
+    }
+    else if (ends_with(singular, "baum") || ends_with(singular, "Baum"))
+    {
+        plural = _replace_end(plural, 3, "äume");
+        certain = true;
+    }
+    else if (_ends_with_any(singular, unchanged))
+        certain = true;
+    else if (ends_with(lowercase_string(singular), "geist"))
+    {
+        plural += "er";
+        certain = true;
+    }
+    else if (ends_with(lowercase_string(singular), "bär"))
+    {
+        plural += "en";
+        certain = true;
+    }
+    else if (ends_with(lowercase_string(singular), "segment"))
+    {
+        plural += "e";
+        certain = true;
+    }
+    else if (ends_with(singular, "e"))
+    {
+        // nouns ending in -e normally add -n (always, if feminine)
+        plural += "n";
+        certain = (gender == GRAM_FEMININE);
+    }
+    else if (_ends_with_char(singular, "aoiuy"))
+    {
+        // nouns ending in other vowels normally add -s, with a few exceptions
+        if (_ends_with_any(singular, a_to_en))
+            plural = _replace_end(plural, 1, "en");
+        else
+            plural += "s";
+    }
+    else if (ends_with(singular, "chen") || ends_with(singular, "lein"))
+        certain = true;
+    else if (ends_with(singular, "el") || ends_with(singular, "er"))
+    {
+        // feminine nouns add -n (e.g. Kugeln), masc/neut usually don't change
+        if (gender == GRAM_FEMININE)
+            plural += "n";
+        else if (ends_with(singular, "tier") || ends_with(singular, "Tier"))
+            plural += "e";
+    }
+    else if (ends_with(singular, "us"))
+    {
+        if (gender == GRAM_FEMININE && ends_with(singular, "aus"))
+        {
+            // Fledermäuse, etc.
+            plural = _replace_end(plural, 3, "äuse");
+            certain = true;
+        }
+        else if (ends_with(singular, "Ufetubus"))
+        {
+            plural = _replace_end(plural, 2, "i");
+            certain = true;
+        }
+        else
+            plural = _replace_end(plural, 2, "en");
+    }
+    else if (ends_with(singular, "um"))
+        plural = _replace_end(plural, 2, "en");
+    else if (ends_with(singular, "nis"))
+    {
+        plural += "se";
+        certain = true;
+    }
+    else if (ends_with(singular, add_e))
+    {
+        plural += "e";
+        certain = true;
+    }
+    else if (ends_with(singular, maybe_add_e))
+        plural += "e";
+    else if (ends_with(singular, add_en))
+    {
+        plural += "en";
+        certain = true;
+    }
+    else if (gender == GRAM_FEMININE)
+    {
+        certain = true;
+        if (ends_with(singular, "in"))
+            plural += "nen";  // Königinnen, etc
+        else if (ends_with(singular, "itis"))
+            plural = _replace_end(plural, 4, "iden");
+        else if (ends_with(singular, "xis"))
+            plural = _replace_end(plural, 3, "xien");
+        else if (ends_with(singular, "sis"))
+            plural = _replace_end(plural, 3, "sen");
+        else
+        {
+            certain = ends_with(singular, fem_add_en);
+            plural += "en";
+        }
+    }
+    else
+    {
+        // other words normally add -e
+        plural += "e";
+    }
+
+    if (gcase == GCASE_DAT)
+    {
+        // dative plural ends in -n (unless it's already -n, -s or -i)
+        if (!_ends_with_char(plural, "nsi"))
+            plural += "n";
+
+        // adjective ending is -en
+        plural = replace_all(plural, "e ", "en ");
+    }
+
+    return plural + noun.suffix;
+}
+
+bool german_case_bundle::empty() const
+{
+    for (int i = 0; i < NUM_GCASES; i++)
+        if (!singular[i].empty() || !plural[i].empty())
+            return false;
+    return true;
+}
+
+string_view german_case_bundle::get(german_case gcase, int count) const
+{
+    // German only has one plural form
+    return count == 1 ? singular[gcase] : plural[gcase];
+}
+
+bool german_case_from_context(const string &context, german_case &gcase)
+{
+    if (context.empty())
+    {
+        gcase = GCASE_NOM;
+        return true;
+    }
+
+    for (int i = 0; i < NUM_GCASES; i++)
+    {
+        if (context == case_names[i])
+        {
+            gcase = static_cast<german_case>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Split an English phrase into article and lemma
+static bool _parse_english(const string &value, string &lemma, bool &definite)
+{
+    if (starts_with(value, "the "))
+    {
+        lemma = value.substr(4);
+        definite = true;
+    }
+    else if (starts_with(value, "a "))
+    {
+        lemma = value.substr(2);
+        definite = false;
+    }
+    else if (starts_with(value, "an "))
+    {
+        lemma = value.substr(3);
+        definite = false;
+    }
+    else
+        return false;
+    return true;
+}
+
+bool german_declinable(const string &value)
+{
+    string lemma;
+    bool definite;
+    return _parse_english(value, lemma, definite);
+}
+
+// a translation in exactly this context (singular, or plural for count 2)
+static bool _exception(const string &domain, const string &context,
+                       const string &value, const string &plural,
+                       bool want_plural, string &result)
+{
+    if (plural.empty())
+        return !want_plural && dcxlate_exact(domain, context, value, result);
+    else
+    {
+        return dcnxlate_exact(domain, context, value, plural,
+                              want_plural ? 2 : 1, result);
+    }
+}
+
+// Work out all the forms of an English phrase, without the cache.
+static void _build_bundle(const string &domain, const string &value,
+                          const string &plural, cached_bundle &bundle)
+{
+    string lemma;
+    bool definite = false;
+    german_noun noun;
+    if (_parse_english(value, lemma, definite))
+    {
+        // look up the lexicon entry: the nominative with the definite article
+        const string en_nominative = "the " + lemma;
+        const string de_nominative = dcxlate(domain, "", en_nominative);
+        if (de_nominative != en_nominative && !de_nominative.empty())
+            noun = parse_german_noun(de_nominative);
+    }
+    bundle.views.features = noun.features;
+
+    for (int i = 0; i < NUM_GCASES; i++)
+    {
+        const german_case gcase = static_cast<german_case>(i);
+        for (int want_plural = 0; want_plural < 2; want_plural++)
+        {
+            if (want_plural && plural.empty())
+                continue;
+
+            string &form = want_plural ? bundle.plural[i] : bundle.singular[i];
+
+            // the global context holds the nominative
+            if (_exception(domain, case_names[i], value, plural, want_plural,
+                           form)
+                || (i == GCASE_NOM
+                    && _exception(domain, "", value, plural, want_plural,
+                                  form)))
+            {
+                continue;
+            }
+
+            if (noun.features.gender == GRAM_GENDER_NONE
+                || (want_plural && definite))
+                continue;
+            else if (want_plural)
+            {
+                bool certain;
+                form = decline_german_plural(noun, gcase, certain);
+            }
+            else
+                form = decline_german_singular(noun, definite, gcase);
+        }
+    }
+}
+
+const german_case_bundle *german_cases(const string &domain,
+                                       const string &value,
+                                       const string &plural)
+{
+    string key = get_xlate_language();
+    key += '\x04';
+    key += domain;
+    key += '\x04';
+    key += value;
+    key += '\x04';
+    key += plural;
+
+    {
+        lock_guard<mutex> lock(bundle_cache_lock);
+        const cached_bundle *cached = map_find(bundle_cache, key);
+        if (cached)
+            return &cached->views;
+    }
+
+    // build outside the lock (it does catalog lookups)
+    cached_bundle built;
+    _build_bundle(domain, value, plural, built);
+
+    lock_guard<mutex> lock(bundle_cache_lock);
+    auto ins = bundle_cache.emplace(move(key), cached_bundle());
+    cached_bundle &bundle = ins.first->second;
+    if (ins.second)
+    {
+        // (another thread may have got there first)
+        bundle.views.features = built.views.features;
+        for (int i = 0; i < NUM_GCASES; i++)
+        {
+            bundle.singular[i] = move(built.singular[i]);
+            bundle.plural[i] = move(built.plural[i]);
+            bundle.views.singular[i] = bundle.singular[i];
+            bundle.views.plural[i] = bundle.plural[i];
+        }
+    }
+    return &bundle.views;
+}
+
+bool german_decline(const string &domain, const string &gcase,
+                    const string &value, const string &plural, int count,
+                    string &result)
+{
+    german_case c;
+    if (!german_case_from_context(gcase, c))
+        return false;
+
+    const german_case_bundle *bundle = german_cases(domain, value, plural);
+    const string_view form = plural.empty() ? bundle->singular[c]
+                                            : bundle->get(c, count);
+    if (form.empty())
+        return false;
+    result.assign(form.data(), form.size());
+    return true;
+}
+
+const char *german_pronoun(const german_case_bundle &noun, gender_type gender,
+                           pronoun_type variant)
+{
+    grammar_features features = noun.features;
+    // the player is du whatever they're called
+    if (features.gender == GRAM_GENDER_NONE || gender == GENDER_YOU)
+        features = natural_gender_features(gender);
+    return agreeing_pronoun("de", features, variant);
+}
+
+void german_clear_cache()
+{
+    lock_guard<mutex> lock(bundle_cache_lock);
+    bundle_cache.clear();
+}
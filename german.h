@@ -0,0 +1,118 @@
+/**
+ * @file
+ * @brief Functions dealing with the morphology of the German language.
+ *
+ * The German catalogs only need to hold the nominative singular of a noun
+ * phrase with its definite article (e.g. "the frilled lizard" ->
+ * "die gekräuselte Eidechse"). The other cases ("akk", "dat"), the
+ * indefinite article and the plural are derived from that at runtime.
+**/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+using std::string;
+using std::string_view;
+
+#include "grammar.h"
+
+// grammar_features::noun_class
+enum german_noun_class
+{
+    GERMAN_STRONG,
+    // masculine noun taking -n/-en outside the nominative (e.g. der Bär)
+    GERMAN_WEAK,
+};
+
+enum german_case
+{
+    GCASE_NOM,
+    GCASE_AKK,
+    GCASE_DAT,
+    NUM_GCASES
+};
+
+// Every form of a noun phrase, so a name used in several cases costs one
+// lookup. Empty if there is no such form (e.g. no plural was asked for).
+// These view strings owned by the cache, so are valid until
+// german_clear_cache().
+struct german_case_bundle
+{
+    string_view singular[NUM_GCASES];
+    // template for the count, e.g. "%d Orks"
+    string_view plural[NUM_GCASES];
+    // of the lexicon entry
+    grammar_features features;
+
+    bool empty() const;
+    // singular or plural according to count (for phrases with a plural)
+    string_view get(german_case gcase, int count) const;
+};
+
+// A lexicon entry: a German noun phrase in the nominative singular
+struct german_noun
+{
+    // with definite article, but without any " of ..." suffix
+    // (e.g. "die Motte" for "die Motte des Zorns")
+    string phrase;
+    // " of ..." suffix, which takes no part in declension (e.g. " des Zorns")
+    string suffix;
+    // gender (from the article) and declension class
+    grammar_features features;
+};
+
+// Is lang German (de, de_DE, de_AT, ...)?
+bool is_german(const string &lang);
+
+// Split off " of ..." (also " von ...", " des ...", " der ...").
+// Returns the text before it; the suffix (including leading space) goes
+// into suffix.
+string split_of(const string &text, string &suffix);
+
+// parse a nominative singular with definite article ("der Ork")
+german_noun parse_german_noun(const string &nominative);
+
+string decline_german_singular(const german_noun &noun, bool definite,
+                               german_case gcase);
+
+// Plural (without article) as a template for the count, e.g. "%d Orks".
+// Sets certain to false if the rules are only guessing.
+string decline_german_plural(const german_noun &noun, german_case gcase,
+                             bool &certain);
+
+// "nom", "akk" or "dat" (empty context means nominative)
+// returns false for any other context
+bool german_case_from_context(const string &context, german_case &gcase);
+
+// Does an English phrase start with an article ("the orc", "an orc"), so
+// that german_cases() might decline it?
+bool german_declinable(const string &value);
+
+// All the cases of an English noun phrase in German: "the orc", or "an orc"
+// with plural "%d orcs". Exceptions in the catalog (a translation in the
+// exact context) take priority; otherwise the forms are declined from the
+// lexicon entry, which is the translation of "the <noun>" in domain.
+// Never returns null, but the bundle is empty if the phrase can't be
+// declined (no article, or no lexicon entry).
+const german_case_bundle *german_cases(const string &domain,
+                                       const string &value,
+                                       const string &plural);
+
+// One form from german_cases(): gcase is "nom", "akk" or "dat".
+// If plural is given then result is the singular or plural template
+// according to count (the caller fills in the count).
+// Returns false if it can't be declined.
+bool german_decline(const string &domain, const string &gcase,
+                    const string &value, const string &plural, int count,
+                    string &result);
+
+// Pronoun referring to a noun phrase (from german_cases()), which agrees
+// with its grammatical gender. If there's no lexicon entry, gender is the
+// natural gender to go by. GENDER_YOU always gives the second person.
+const char *german_pronoun(const german_case_bundle &noun, gender_type gender,
+                           pronoun_type variant);
+
+// forget previously declined phrases (e.g. after reloading the catalogs);
+// init_localization() does this
+void german_clear_cache();
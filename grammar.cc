@@ -0,0 +1,93 @@
+/**
+ * @file
+ * @brief Grammatical features of nouns, and the per-language rules which
+ *        depend on them.
+**/
+
+#include "AppHdr.h"
+#include "grammar.h"
+
+#include "stringutil.h"
+
+// [plural][gender][variant]
+typedef const char * const pronoun_table[2][4][NUM_PRONOUN_CASES];
+// [plural][variant]
+typedef const char * const second_person_table[2][NUM_PRONOUN_CASES];
+
+// objective is accusative (the dative would be ihm/ihr/ihm/ihnen)
+// possessive is the stem: the ending agrees with what is possessed
+static pronoun_table german_pronouns =
+{
+    {
+        // subj  poss    refl    obj
+        { "es",  "sein", "sich", "es"  }, // none
+        { "er",  "sein", "sich", "ihn" }, // masculine
+        { "sie", "ihr",  "sich", "sie" }, // feminine
+        { "es",  "sein", "sich", "es"  }, // neuter
+    },
+    {
+        { "sie", "ihr",  "sich", "sie" },
+        { "sie", "ihr",  "sich", "sie" },
+        { "sie", "ihr",  "sich", "sie" },
+        { "sie", "ihr",  "sich", "sie" },
+    },
+};
+
+// the player is addressed familiarly
+static second_person_table german_second_person =
+{
+    // subj   poss    refl    obj
+    { "du",  "dein", "dich", "dich" },
+    { "ihr", "euer", "euch", "euch" },
+};
+
+static const struct
+{
+    const char *lang;
+    pronoun_table *pronouns;
+    second_person_table *second_person;
+} language_rules[] =
+{
+    { "de", &german_pronouns, &german_second_person },
+};
+
+grammar_features natural_gender_features(gender_type gender)
+{
+    grammar_features features;
+    switch (gender)
+    {
+    case GENDER_MALE:
+        features.gender = GRAM_MASCULINE;
+        break;
+    case GENDER_FEMALE:
+        features.gender = GRAM_FEMININE;
+        break;
+    case GENDER_NEUTRAL:
+        // singular they takes plural agreement
+        features.plural = 1;
+        break;
+    case GENDER_YOU:
+        features.second_person = 1;
+        break;
+    default:
+        features.gender = GRAM_NEUTER;
+        break;
+    }
+    return features;
+}
+
+const char *agreeing_pronoun(const string &lang, grammar_features features,
+                             pronoun_type variant)
+{
+    ASSERT_RANGE(variant, 0, NUM_PRONOUN_CASES);
+
+    for (const auto &rules : language_rules)
+    {
+        if (lang != rules.lang && !starts_with(lang, string(rules.lang) + "_"))
+            continue;
+        if (features.second_person)
+            return (*rules.second_person)[features.plural][variant];
+        return (*rules.pronouns)[features.plural][features.gender][variant];
+    }
+    return nullptr;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file
+ * @brief Grammatical features of nouns, and the per-language rules which
+ *        depend on them.
+**/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+using std::string;
+
+#include "gender-type.h"
+#include "pronoun-type.h"
+
+enum grammatical_gender
+{
+    GRAM_GENDER_NONE,   // unknown, or the language doesn't have one
+    GRAM_MASCULINE,
+    GRAM_FEMININE,
+    GRAM_NEUTER,
+};
+
+// Features of a noun in a particular language, small enough to keep with
+// every translation. This is the grammatical gender (die Motte), not
+// the natural gender of whatever the noun refers to.
+struct grammar_features
+{
+    uint8_t gender : 2;      // grammatical_gender
+    uint8_t plural : 1;
+    // language-specific declension class (e.g. German weak masculine nouns)
+    uint8_t noun_class : 2;
+    // the addressee (GENDER_YOU), who takes second person pronouns
+    uint8_t second_person : 1;
+
+    grammar_features()
+        : gender(GRAM_GENDER_NONE), plural(0), noun_class(0), second_person(0)
+    {
+    }
+
+    grammatical_gender get_gender() const
+    {
+        return static_cast<grammatical_gender>(gender);
+    }
+};
+
+// For languages whose pronouns follow who (or what) is being referred to
+grammar_features natural_gender_features(gender_type gender);
+
+// Pronoun agreeing with a noun with the given features, in the language
+// given. Returns null if the language has no table; English has none, since
+// its pronouns follow natural gender (use decline_pronoun()).
+const char *agreeing_pronoun(const string &lang, grammar_features features,
+                             pronoun_type variant);
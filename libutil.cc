@@ -122,6 +122,24 @@ bool key_is_escape(int key)
 }
 #endif
 
+// Position of the first tag in s with a space before and/or after it
+// (including the space before), or npos.
+static string::size_type _find_padded_tag(const string &s, const string &tag,
+                                          bool before, bool after)
+{
+    for (string::size_type pos = s.find(tag, before ? 1 : 0);
+         pos != string::npos; pos = s.find(tag, pos + 1))
+    {
+        const string::size_type end = pos + tag.length();
+        if ((!before || s[pos - 1] == ' ')
+            && (!after || (end < s.length() && s[end] == ' ')))
+        {
+            return before ? pos - 1 : pos;
+        }
+    }
+    return string::npos;
+}
+
 // Returns true if s contains tag 'tag', and strips out tag from s.
 bool strip_tag(string &s, const string &tag, bool skip_padding)
 {
@@ -144,7 +162,7 @@ bool strip_tag(string &s, const string &tag, bool skip_padding)
         return false;
     }
 
-    if ((pos = s.find(" " + tag + " ")) != string::npos)
+    if ((pos = _find_padded_tag(s, tag, true, true)) != string::npos)
     {
         // Leave one space intact.
         s.erase(pos, tag.length() + 1);
@@ -152,8 +170,8 @@ bool strip_tag(string &s, const string &tag, bool skip_padding)
         return true;
     }
 
-    if ((pos = s.find(tag + " ")) == 0
-        || ((pos = s.find(" " + tag)) != string::npos
+    if ((pos = _find_padded_tag(s, tag, false, true)) == 0
+        || ((pos = _find_padded_tag(s, tag, true, false)) != string::npos
             && pos + tag.length() + 1 == s.length()))
     {
         s.erase(pos, tag.length() + 1);
@@ -180,13 +198,21 @@ vector<string> strip_multiple_tag_prefix(string &s, const string &tagprefix)
     return results;
 }
 
-string strip_tag_prefix(string &s, const string &tagprefix)
+// Position of the first tagprefix at the start of a word in s, or npos.
+static string_view::size_type _find_tag_prefix(string_view s,
+                                               string_view tagprefix)
 {
-    string::size_type pos = s.find(tagprefix);
+    string_view::size_type pos = s.find(tagprefix);
 
-    while (pos && pos != string::npos && !isspace(s[pos - 1]))
+    while (pos && pos != string_view::npos && !isspace(s[pos - 1]))
         pos = s.find(tagprefix, pos + 1);
 
+    return pos;
+}
+
+string strip_tag_prefix(string &s, const string &tagprefix)
+{
+    const string::size_type pos = _find_tag_prefix(s, tagprefix);
     if (pos == string::npos)
         return "";
 
@@ -205,16 +231,18 @@ string strip_tag_prefix(string &s, const string &tagprefix)
 
 const string tag_without_prefix(const string &s, const string &tagprefix)
 {
-    string::size_type pos = s.find(tagprefix);
-
-    while (pos && pos != string::npos && !isspace(s[pos - 1]))
-        pos = s.find(tagprefix, pos + 1);
+    return string(tag_without_prefix_view(s, tagprefix));
+}
 
-    if (pos == string::npos)
-        return "";
+// As tag_without_prefix(), but a view into s.
+string_view tag_without_prefix_view(string_view s, string_view tagprefix)
+{
+    const string_view::size_type pos = _find_tag_prefix(s, tagprefix);
+    if (pos == string_view::npos)
+        return string_view();
 
-    string::size_type ns = s.find(" ", pos);
-    if (ns == string::npos)
+    string_view::size_type ns = s.find(' ', pos);
+    if (ns == string_view::npos)
         ns = s.length();
 
     return s.substr(pos + tagprefix.length(), ns - pos - tagprefix.length());
@@ -231,11 +259,53 @@ int strip_number_tag(string &s, const string &tagprefix)
 
 unordered_set<string> parse_tags(const string &tags)
 {
-    vector<string> split_tags = split_string(" ", tags);
-    unordered_set<string> tags_set(split_tags.begin(), split_tags.end());
+    unordered_set<string> tags_set;
+    for (string_view tag : split_view(tags, " "))
+        tags_set.emplace(tag);
     return tags_set;
 }
 
+tag_set::tag_set(string_view tags) : text(tags)
+{
+    for (string_view tag : split_view(text, " "))
+        spans.emplace_back(tag.data() - text.data(), tag.length());
+
+    const auto less = [this](const pair<uint32_t, uint32_t> &a,
+                             const pair<uint32_t, uint32_t> &b)
+    {
+        return text.compare(a.first, a.second, text, b.first, b.second) < 0;
+    };
+    const auto same = [this](const pair<uint32_t, uint32_t> &a,
+                             const pair<uint32_t, uint32_t> &b)
+    {
+        return text.compare(a.first, a.second, text, b.first, b.second) == 0;
+    };
+    sort(spans.begin(), spans.end(), less);
+    spans.erase(unique(spans.begin(), spans.end(), same), spans.end());
+}
+
+bool tag_set::contains(string_view tag) const
+{
+    size_t lo = 0, hi = spans.size();
+    while (lo < hi)
+    {
+        const size_t mid = (lo + hi) / 2;
+        const int cmp = (*this)[mid].compare(tag);
+        if (cmp == 0)
+            return true;
+        else if (cmp < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return false;
+}
+
+tag_set parse_tag_set(string_view tags)
+{
+    return tag_set(tags);
+}
+
 bool parse_int(const char *s, int &i)
 {
     if (!s || !*s)
@@ -261,32 +331,41 @@ bool parse_int(const char *s, int &i)
 **/
 int numcmp(const char *a, const char *b, int limit)
 {
+    return numcmp(string_view(a), string_view(b), limit);
+}
+
+int numcmp(string_view a, string_view b, int limit)
+{
+    // (as if NUL-terminated)
+    size_t i = 0, j = 0;
+    auto ca = [&]() { return i < a.length() ? a[i] : '\0'; };
+    auto cb = [&]() { return j < b.length() ? b[j] : '\0'; };
     int res;
 
     do
     {
-        while (*a && *a == *b && !isadigit(*a))
+        while (ca() && ca() == cb() && !isadigit(ca()))
         {
-            a++;
-            b++;
+            i++;
+            j++;
         }
-        if (!isadigit(*a) || !isadigit(*b))
-            return (*a < *b) ? -1 : (*a > *b) ? 1 : 0;
-        while (*a == '0')
-            a++;
-        while (*b == '0')
-            b++;
+        if (!isadigit(ca()) || !isadigit(cb()))
+            return (ca() < cb()) ? -1 : (ca() > cb()) ? 1 : 0;
+        while (ca() == '0')
+            i++;
+        while (cb() == '0')
+            j++;
         res = 0;
-        while (isadigit(*a))
+        while (isadigit(ca()))
         {
-            if (!isadigit(*b))
+            if (!isadigit(cb()))
                 return 1;
-            if (*a != *b && !res)
-                res = (*a < *b) ? -1 : 1;
-            a++;
-            b++;
+            if (ca() != cb() && !res)
+                res = (ca() < cb()) ? -1 : 1;
+            i++;
+            j++;
         }
-        if (isadigit(*b))
+        if (isadigit(cb()))
             return -1;
         if (res)
             return res;
@@ -295,9 +374,9 @@ int numcmp(const char *a, const char *b, int limit)
 }
 
 // make STL sort happy
-bool numcmpstr(const string& a, const string& b)
+bool numcmpstr(string_view a, string_view b)
 {
-    return numcmp(a.c_str(), b.c_str()) == -1;
+    return numcmp(a, b) == -1;
 }
 
 bool version_is_stable(const char *v)
@@ -8,6 +8,7 @@
 #include <cctype>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_set>
 #include <memory>
@@ -89,7 +90,8 @@ template<typename T> inline T toupper_safe(T c)
 }
 
 int numcmp(const char *a, const char *b, int limit = 0);
-bool numcmpstr(const string &a, const string &b);
+int numcmp(string_view a, string_view b, int limit = 0);
+bool numcmpstr(string_view a, string_view b);
 
 bool version_is_stable(const char *ver);
 
@@ -100,7 +102,35 @@ int strip_number_tag(string &s, const string &tagprefix);
 vector<string> strip_multiple_tag_prefix(string &s, const string &tagprefix);
 string strip_tag_prefix(string &s, const string &tagprefix);
 const string tag_without_prefix(const string &s, const string &tagprefix);
+string_view tag_without_prefix_view(string_view s, string_view tagprefix);
 unordered_set<string> parse_tags(const string &tags);
+
+/**
+ * The tags of a space-separated list, as parse_tags() but without a string
+ * per tag: the set keeps one copy of the list, and a sorted table of where
+ * each distinct tag is in it.
+ */
+class tag_set
+{
+public:
+    tag_set() = default;
+    explicit tag_set(string_view tags);
+
+    bool contains(string_view tag) const;
+    size_t size() const { return spans.size(); }
+    bool empty() const { return spans.empty(); }
+    // in sorted order
+    string_view operator[](size_t i) const
+    {
+        return string_view(text.data() + spans[i].first, spans[i].second);
+    }
+
+private:
+    // (offsets rather than views, so copies don't point into the original)
+    string text;
+    vector<pair<uint32_t, uint32_t>> spans;
+};
+tag_set parse_tag_set(string_view tags);
 bool parse_int(const char *s, int &i);
 
 // String 'descriptions'
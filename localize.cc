@@ -3,14 +3,19 @@
  * High-level localization functions
  */
 
-#include <sstream>
 #include <vector>
 #include <cstdarg>
 #include <cstdlib>
+#include <mutex>
+#include <shared_mutex>
 #include <typeinfo>
 using namespace std;
 
 #include "localize.h"
+#include "english.h"
+#include "german.h"
+#include "multi-replace.h"
+#include "number-format.h"
 #include "xlate.h"
 #include "stringutil.h"
 
@@ -288,28 +293,65 @@ static map<int, const type_info*> _get_arg_types(const string& fmt)
     return results;
 }
 
-// replace all instances of given substring
-// std::regex_replace would do this, but not sure if available on all platforms
-static void _replace_all(std::string& str, const std::string& patt, const std::string& replace)
+// append str to result, resolving escapes
+static void _append_unescaped(const string& str, string& result)
 {
-    std::string::size_type pos = 0u;
-    while((pos = str.find(patt, pos)) != std::string::npos){
-        str.replace(pos, patt.length(), replace);
-        pos += replace.length();
-    }
+    static const multi_replacer escapes({{"%%", "%"}, {"\\{", "{"}, {"\\}", "}"}});
+    escapes.replace(str, result);
 }
 
-static void _resolve_escapes(string& str)
+
+static bool _localize_exact(const string& domain, const string& context, const string& value, const string& plural_val, const int count, string& result)
 {
-    _replace_all(str, "%%", "%");
-    _replace_all(str, "\\{", "{");
-    _replace_all(str, "\\}", "}");
+    if (plural_val.empty())
+        return dcxlate_exact(domain, context, value, result);
+    else
+        return dcnxlate_exact(domain, context, value, plural_val, count, result);
 }
 
+// German catalogs only hold nouns in the nominative with definite article,
+// so the other cases and articles are declined here, unless the catalog has
+// an exception for the exact context
+static bool _localize_german_noun(const string& domain, const string& context, const string& value, const string& plural_val, const int count, string& result)
+{
+    german_case gcase;
+    if (!german_case_from_context(context, gcase))
+        return false;
+
+    // most strings without context aren't nouns (format strings, names...),
+    // so leave those to the plain lookup rather than caching them
+    if (context.empty() && !german_declinable(value))
+        return false;
+
+    bool found = context.empty()
+                 && _localize_exact(domain, "", value, plural_val, count, result);
+
+    if (!found)
+    {
+        // all cases at once, since a name is usually wanted in several
+        const german_case_bundle *bundle = german_cases(domain, value, plural_val);
+        const string_view form = plural_val.empty() ? bundle->singular[gcase]
+                                                    : bundle->get(gcase, count);
+        found = !form.empty();
+        if (found)
+            result.assign(form.data(), form.size());
+    }
+
+    if (found && !plural_val.empty())
+        result = make_stringf(result.c_str(), count);
+    return found;
+}
 
 // localize a single string
 static string _localize_string(const string& domain, const string& context, const string& value, const string& plural_val, const int count)
 {
+    string declined;
+    if (is_german(get_xlate_language())
+        && _localize_german_noun(domain, context, value, plural_val, count, declined))
+    {
+        return declined;
+    }
+
     if (plural_val.empty())
     {
         return dcxlate(domain, context, value);
@@ -324,6 +366,7 @@ static string _localize_string(const string& domain, const string& context, cons
 
 void LocalizationArg::init()
 {
+    type = LOC_ARG_NONE;
     intVal = 0;
     longVal = 0L;
     longLongVal = 0L;
@@ -342,18 +385,21 @@ LocalizationArg::LocalizationArg(const string& value)
     : stringVal(value)
 {
     init();
+    type = LOC_ARG_STRING;
 }
 
 LocalizationArg::LocalizationArg(const string& dom, const string& value)
     : domain(dom), stringVal(value)
 {
     init();
+    type = LOC_ARG_STRING;
 }
 
 LocalizationArg::LocalizationArg(const string& value, const string& plural_val, const int num)
     : stringVal(value), plural(plural_val)
 {
     init();
+    type = LOC_ARG_STRING;
     count = num;
 }
 
@@ -361,58 +407,150 @@ LocalizationArg::LocalizationArg(const string& dom, const string& value, const s
     : domain(dom), stringVal(value), plural(plural_val)
 {
     init();
+    type = LOC_ARG_STRING;
     count = num;
 }
 
 LocalizationArg::LocalizationArg(const int value)
 {
     init();
+    type = LOC_ARG_INT;
     intVal = value;
 }
 
 LocalizationArg::LocalizationArg(const long value)
 {
     init();
+    type = LOC_ARG_LONG;
     longVal = value;
 }
 
 LocalizationArg::LocalizationArg(const long long value)
 {
     init();
+    type = LOC_ARG_LONG_LONG;
     longLongVal = value;
 }
 
 LocalizationArg::LocalizationArg(const double value)
 {
     init();
+    type = LOC_ARG_DOUBLE;
     doubleVal = value;
 }
 
 LocalizationArg::LocalizationArg(const long double value)
 {
     init();
+    type = LOC_ARG_LONG_DOUBLE;
     longDoubleVal = value;
 }
 
+// Held shared to look things up, exclusively to switch language.
+static shared_mutex language_lock;
+
 void init_localization(const string& lang)
 {
+    unique_lock<shared_mutex> lock(language_lock);
     init_xlate(lang);
+    // (localize() only uses bundles while it holds the lock)
+    german_clear_cache();
 }
 
-const string& get_localization_language()
+string get_localization_language()
 {
+    shared_lock<shared_mutex> lock(language_lock);
     return get_xlate_language();
 }
 
-string localize(const vector<LocalizationArg>& args)
+// Formatted numeric args, keyed by arg id and format spec.
+// Numbers only depend on the language through its punctuation, so when
+// rendering the same args into several languages we only need to format
+// each one once per punctuation.
+typedef map<pair<int, string>, string> formatted_args;
+
+// format a non-string arg, appending to result
+static void _format_numeric_arg(const LocalizationArg& arg, const type_info& type,
+                                const string& fmt_spec,
+                                const number_punctuation& punct, string& result)
 {
-    if (args.empty())
+    format_spec spec;
+    if (!parse_format_spec(fmt_spec, spec))
     {
-        return "";
+        // not something we handle (e.g. %a) - leave it to vsnprintf
+        if (type == typeid(long double))
+        {
+            result += make_stringf(fmt_spec.c_str(), arg.longDoubleVal);
+        }
+        else if (type == typeid(double))
+        {
+            result += make_stringf(fmt_spec.c_str(), arg.doubleVal);
+        }
+        else if (type == typeid(long long) || type == typeid(unsigned long long))
+        {
+            result += make_stringf(fmt_spec.c_str(), arg.longLongVal);
+        }
+        else if (type == typeid(long) || type == typeid(unsigned long))
+        {
+            result += make_stringf(fmt_spec.c_str(), arg.longVal);
+        }
+        else if (type == typeid(int) || type == typeid(unsigned int))
+        {
+            result += make_stringf(fmt_spec.c_str(), arg.intVal);
+        }
+        else
+        {
+            result += fmt_spec;
+        }
     }
+    else if (type == typeid(long double))
+    {
+        format_float(result, arg.longDoubleVal, true, spec, punct);
+    }
+    else if (type == typeid(double))
+    {
+        format_float(result, arg.doubleVal, false, spec, punct);
+    }
+    else if (type == typeid(long long))
+    {
+        format_signed(result, arg.longLongVal, spec, punct);
+    }
+    else if (type == typeid(unsigned long long))
+    {
+        format_unsigned(result, (unsigned long long)arg.longLongVal, spec, punct);
+    }
+    else if (type == typeid(long))
+    {
+        format_signed(result, arg.longVal, spec, punct);
+    }
+    else if (type == typeid(unsigned long))
+    {
+        format_unsigned(result, (unsigned long)arg.longVal, spec, punct);
+    }
+    else if (type == typeid(int))
+    {
+        format_signed(result, arg.intVal, spec, punct);
+    }
+    else if (type == typeid(unsigned int))
+    {
+        format_unsigned(result, (unsigned int)arg.intVal, spec, punct);
+    }
+    else
+    {
+        result += fmt_spec;
+    }
+}
 
+// Localize args into the current language, appending to result.
+// arg_types must come from the English format string (args[0]).
+// If numbers is given, formatted numbers are cached there.
+static void _localize(const vector<LocalizationArg>& args,
+                      const map<int, const type_info*>& arg_types,
+                      const number_punctuation& punct,
+                      formatted_args* numbers, string& result)
+{
     // first argument is the format string
-    LocalizationArg fmt_arg = args.at(0);
+    const LocalizationArg& fmt_arg = args.at(0);
 
     // translate format string
     string fmt_xlated;
@@ -428,17 +566,13 @@ string localize(const vector<LocalizationArg>& args)
     if (args.size() == 1 || fmt_xlated.empty())
     {
         // We're done here
-        return fmt_xlated;
+        result += fmt_xlated;
+        return;
     }
 
-    // get arg types for original English string
-    map<int, const type_info*> arg_types = _get_arg_types(fmt_arg.stringVal);
-
     // now tokenize the translated string
     vector<string> strings = _split_format(fmt_xlated);
 
-    ostringstream ss;
-
     string context;
     int arg_count = 0;
     for (vector<string>::iterator it = strings.begin() ; it != strings.end(); ++it)
@@ -455,13 +589,13 @@ string localize(const vector<LocalizationArg>& args)
             int arg_id = _get_arg_id(*it);
             arg_id = (arg_id == 0 ? arg_count : arg_id);
 
-            map<int, const type_info*>::iterator type_entry = arg_types.find(arg_id);
+            map<int, const type_info*>::const_iterator type_entry = arg_types.find(arg_id);
 
             // range check arg id
             if (type_entry == arg_types.end() || arg_id >= args.size())
             {
                 // argument id is out of range - just regurgitate the original string
-                ss << *it;
+                result += *it;
             }
             else
             {
@@ -471,10 +605,10 @@ string localize(const vector<LocalizationArg>& args)
                 const type_info* type = _format_spec_to_type(fmt_spec);
                 const type_info* expected_type = type_entry->second;
 
-                string s = fmt_spec;
                 if (expected_type == NULL || type == NULL || *type != *expected_type)
                 {
                     // something's wrong - skip this arg
+                    result += fmt_spec;
                 }
                 else if (*type == typeid(char*))
                 {
@@ -488,41 +622,174 @@ string localize(const vector<LocalizationArg>& args)
                     {
                         argx = arg.stringVal;
                     }
-                    s = make_stringf(fmt_spec.c_str(), argx.c_str());
-                }
-                else if (*type == typeid(long double))
-                {
-                    s = make_stringf(fmt_spec.c_str(), arg.longDoubleVal);
-                }
-                else if (*type == typeid(double))
-                {
-                    s = make_stringf(fmt_spec.c_str(), arg.doubleVal);
-                }
-                else if (*type == typeid(long long) || *type == typeid(unsigned long long))
-                {
-                    s = make_stringf(fmt_spec.c_str(), arg.longLongVal);
+                    format_spec spec;
+                    if (parse_format_spec(fmt_spec, spec))
+                    {
+                        format_string(result, argx, spec);
+                    }
+                    else
+                    {
+                        result += make_stringf(fmt_spec.c_str(), argx.c_str());
+                    }
                 }
-                else if (*type == typeid(long) || *type == typeid(unsigned long))
+                else if (!numbers)
                 {
-                    s = make_stringf(fmt_spec.c_str(), arg.longVal);
+                    _format_numeric_arg(arg, *type, fmt_spec, punct, result);
                 }
-                else if (*type == typeid(int) || *type == typeid(unsigned int))
+                else
                 {
-                    s = make_stringf(fmt_spec.c_str(), arg.intVal);
+                    pair<int, string> key(arg_id, fmt_spec);
+                    formatted_args::iterator num = numbers->find(key);
+                    if (num == numbers->end())
+                    {
+                        const size_t start = result.length();
+                        _format_numeric_arg(arg, *type, fmt_spec, punct, result);
+                        numbers->insert(make_pair(key, result.substr(start)));
+                    }
+                    else
+                    {
+                        result += num->second;
+                    }
                 }
-                ss << s;
             }
          }
         else
         {
             // plain string (but could have escapes)
-            string str = *it;
-            _resolve_escapes(str);
-            ss << str;
+            _append_unescaped(*it, result);
+        }
+    }
+}
+
+// localize() with the language lock already held
+static string _localize_current(const vector<LocalizationArg>& args)
+{
+    if (args.empty())
+    {
+        return "";
+    }
+
+    // get arg types for original English string
+    map<int, const type_info*> arg_types;
+    if (args.size() > 1)
+    {
+        arg_types = _get_arg_types(args.at(0).stringVal);
+    }
+
+    string result;
+    _localize(args, arg_types, language_punctuation(get_xlate_language()),
+              nullptr, result);
+    return result;
+}
+
+string localize(const vector<LocalizationArg>& args)
+{
+    shared_lock<shared_mutex> lock(language_lock);
+    return _localize_current(args);
+}
+
+// Call render() with language as the current language, switching to it
+// and back if need be.
+template <typename F>
+static void _with_language(const string& language, F render,
+                           language_switch_time* time)
+{
+    {
+        shared_lock<shared_mutex> lock(language_lock);
+        if (language == get_xlate_language())
+        {
+            render();
+            return;
+        }
+    }
+
+    const auto start = chrono::steady_clock::now();
+    unique_lock<shared_mutex> lock(language_lock);
+    const auto locked = chrono::steady_clock::now();
+
+    const string original_lang = get_xlate_language();
+    if (language != original_lang)
+        set_xlate_language(language);
+    render();
+    if (language != original_lang)
+        set_xlate_language(original_lang);
+
+    if (time)
+    {
+        time->exclusive = true;
+        time->wait = locked - start;
+        time->held = chrono::steady_clock::now() - locked;
+    }
+}
+
+string localize_in(const string& language, const vector<LocalizationArg>& args,
+                   language_switch_time* time)
+{
+    string result;
+    _with_language(language, [&] { result = _localize_current(args); }, time);
+    return result;
+}
+
+void localize_batch_in(const string& language,
+                       const vector<vector<LocalizationArg>>& messages,
+                       vector<string>& results, language_switch_time* time)
+{
+    results.resize(messages.size());
+    _with_language(language,
+                   [&]
+                   {
+                       for (size_t i = 0; i < messages.size(); i++)
+                           results[i] = _localize_current(messages[i]);
+                   },
+                   time);
+}
+
+void localize_multi(const vector<LocalizationArg>& args,
+                    const vector<string>& languages, vector<string>& results)
+{
+    results.resize(languages.size());
+    for (string& result : results)
+    {
+        result.clear();
+    }
+
+    if (args.empty() || languages.empty())
+    {
+        return;
+    }
+
+    // analyse the English format string once for all languages
+    map<int, const type_info*> arg_types;
+    if (args.size() > 1)
+    {
+        arg_types = _get_arg_types(args.at(0).stringVal);
+    }
+
+    unique_lock<shared_mutex> lock(language_lock);
+    formatted_args numbers;
+    const number_punctuation* numbers_punct = nullptr;
+    const string original_lang = get_xlate_language();
+    for (size_t i = 0; i < languages.size(); i++)
+    {
+        if (languages[i] != get_xlate_language())
+        {
+            set_xlate_language(languages[i]);
         }
+
+        const number_punctuation& punct = language_punctuation(languages[i]);
+        if (numbers_punct && *numbers_punct != punct)
+        {
+            numbers.clear();
+        }
+        numbers_punct = &punct;
+
+        _localize(args, arg_types, punct, &numbers, results[i]);
     }
 
-    return ss.str();
+    if (original_lang != get_xlate_language())
+    {
+        set_xlate_language(original_lang);
+    }
 }
 
 // same as localize except it capitalizes first letter
@@ -532,6 +799,16 @@ string localize_sentence(const vector<LocalizationArg>& args)
     return uppercase_first(result);
 }
 
+string localize_pronoun(const string& domain, const string& noun,
+                        gender_type gender, pronoun_type variant)
+{
+    shared_lock<shared_mutex> lock(language_lock);
+    if (is_german(get_xlate_language()))
+        return german_pronoun(*german_cases(domain, noun, ""), gender, variant);
+
+    return xlate(decline_pronoun(gender, variant));
+}
+
 // convenience function using va_args (yuk!)
 string localize(const string& fmt_str, ...)
 {
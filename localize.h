@@ -5,17 +5,37 @@
 
 #pragma once
 
+#include <chrono>
+
 #include <string>
 using std::string;
 
 #include <vector>
 using std::vector;
+
+#include "gender-type.h"
+#include "pronoun-type.h"
+
+// Which of the value fields of a LocalizationArg is in use
+enum LocalizationArgType
+{
+    LOC_ARG_NONE,
+    LOC_ARG_STRING,
+    LOC_ARG_INT,
+    LOC_ARG_LONG,
+    LOC_ARG_LONG_LONG,
+    LOC_ARG_DOUBLE,
+    LOC_ARG_LONG_DOUBLE,
+};
+
 /*
  * Structure describing a localization argument
  */
 struct LocalizationArg
 {
 public:
+    LocalizationArgType type;
+
     string domain;
     string stringVal;
     string plural;
@@ -49,12 +69,19 @@ private:
 
 /**
  * Initialize the localization system
+ *
+ * The language is process-wide (gettext reads it from the environment), so
+ * the functions here hold a lock while they look things up, and switching
+ * language (this, localize_in(), localize_batch_in(), localize_multi())
+ * waits for them. Any
+ * thread may call them, but nothing else should call set_xlate_language()
+ * or the xlate functions directly while other threads are localizing.
  */
 void init_localization(const string& lang);
 
 
 // Get the current localization language
-const string& get_localization_language();
+string get_localization_language();
 
 // Localize a format string and a list of args.
 // If there are multiple args, expects the first arg to be a format string.
@@ -65,9 +92,47 @@ const string& get_localization_language();
 // One theoretical case would be: "poison"(en) -> "Gift"(de) -> "Gift"(en) -> "Geschenk"(de).
 string localize(const vector<LocalizationArg>& args);
 
+// How long a call which needed another language had the language lock to
+// itself (so localize() on every other thread, including the game's, was
+// blocked), and how long it waited to get it.
+struct language_switch_time
+{
+    bool exclusive = false;
+    std::chrono::nanoseconds wait{0};
+    std::chrono::nanoseconds held{0};
+};
+
+// Localize into a language other than the current one, e.g. for a client
+// on another thread. The current language is unchanged afterwards.
+// If time is given, it is set to the cost of any language switch.
+string localize_in(const string& language, const vector<LocalizationArg>& args,
+                   language_switch_time* time = nullptr);
+
+// Same for several messages, switching language at most once for the lot.
+// results[i] is set to the text of messages[i].
+void localize_batch_in(const string& language,
+                       const vector<vector<LocalizationArg>>& messages,
+                       vector<string>& results,
+                       language_switch_time* time = nullptr);
+
+// Localize the same args into several languages in one go.
+// results[i] is set to the text in languages[i].
+// The English format string is only analysed once, and numeric args are only
+// formatted once, so this is cheaper than calling localize() per language.
+// The current localization language is restored afterwards.
+void localize_multi(const vector<LocalizationArg>& args,
+                    const vector<string>& languages, vector<string>& results);
+
 // same as localize except it capitalizes first letter
 string localize_sentence(const vector<LocalizationArg>& args);
 
+// Pronoun referring to noun (an English noun phrase, e.g. "the orc").
+// In languages with grammatical gender it agrees with the translation of the
+// noun; otherwise (e.g. English) it goes by the natural gender of whatever
+// the noun refers to.
+string localize_pronoun(const string& domain, const string& noun,
+                        gender_type gender, pronoun_type variant);
+
 // convenience function using va_args (yuk!)
 string localize(const string& fmt_str, ...);
 
@@ -0,0 +1,180 @@
+/*
+ * localized-message.cc
+ * A message whose localization is deferred until it is displayed
+ */
+
+#include "localized-message.h"
+#include "stringutil.h"
+
+using namespace std;
+
+LocalizedMessage::LocalizedMessage()
+{
+}
+
+LocalizedMessage::LocalizedMessage(const vector<LocalizationArg>& args)
+{
+    m_args.reserve(args.size());
+    for (const LocalizationArg& arg : args)
+        add_arg(arg);
+}
+
+LocalizedMessage::LocalizedMessage(const LocalizationArg& arg)
+{
+    add_arg(arg);
+}
+
+LocalizedMessage::LocalizedMessage(const LocalizationArg& arg1,
+                                   const LocalizationArg& arg2)
+{
+    m_args.reserve(2);
+    add_arg(arg1);
+    add_arg(arg2);
+}
+
+LocalizedMessage::LocalizedMessage(const LocalizationArg& arg1,
+                                   const LocalizationArg& arg2,
+                                   const LocalizationArg& arg3)
+{
+    m_args.reserve(3);
+    add_arg(arg1);
+    add_arg(arg2);
+    add_arg(arg3);
+}
+
+// Add a string to the buffer, reusing an identical earlier string if there
+// is one (domains in particular tend to be repeated).
+LocalizedMessage::string_ref LocalizedMessage::_intern(const string& s)
+{
+    string_ref ref = {0, static_cast<uint32_t>(s.length())};
+    if (s.empty())
+        return ref;
+
+    size_t pos = m_strings.find(s);
+    if (pos == string::npos)
+    {
+        pos = m_strings.length();
+        m_strings += s;
+    }
+    ref.offset = static_cast<uint32_t>(pos);
+    return ref;
+}
+
+string LocalizedMessage::_get(const string_ref& ref) const
+{
+    return m_strings.substr(ref.offset, ref.length);
+}
+
+void LocalizedMessage::add_arg(const LocalizationArg& arg)
+{
+    packed_arg packed;
+    packed.type = static_cast<uint8_t>(arg.type);
+    packed.translate = arg.translate;
+    packed.count = arg.count;
+    packed.domain = _intern(arg.domain);
+    packed.value = _intern(arg.stringVal);
+    packed.plural = _intern(arg.plural);
+
+    packed.num.ld = 0.0;
+    switch (arg.type)
+    {
+    case LOC_ARG_INT:
+        packed.num.i = arg.intVal;
+        break;
+    case LOC_ARG_LONG:
+        packed.num.l = arg.longVal;
+        break;
+    case LOC_ARG_LONG_LONG:
+        packed.num.ll = arg.longLongVal;
+        break;
+    case LOC_ARG_DOUBLE:
+        packed.num.d = arg.doubleVal;
+        break;
+    case LOC_ARG_LONG_DOUBLE:
+        packed.num.ld = arg.longDoubleVal;
+        break;
+    default:
+        break;
+    }
+
+    m_args.push_back(packed);
+    clear_rendered();
+}
+
+LocalizationArg LocalizedMessage::arg(size_t index) const
+{
+    const packed_arg& packed = m_args.at(index);
+
+    LocalizationArg result;
+    switch (packed.type)
+    {
+    case LOC_ARG_STRING:
+        result = LocalizationArg(_get(packed.domain), _get(packed.value),
+                                 _get(packed.plural), packed.count);
+        break;
+    case LOC_ARG_INT:
+        result = LocalizationArg(packed.num.i);
+        break;
+    case LOC_ARG_LONG:
+        result = LocalizationArg(packed.num.l);
+        break;
+    case LOC_ARG_LONG_LONG:
+        result = LocalizationArg(packed.num.ll);
+        break;
+    case LOC_ARG_DOUBLE:
+        result = LocalizationArg(packed.num.d);
+        break;
+    case LOC_ARG_LONG_DOUBLE:
+        result = LocalizationArg(packed.num.ld);
+        break;
+    default:
+        break;
+    }
+    result.translate = packed.translate;
+    result.count = packed.count;
+    return result;
+}
+
+vector<LocalizationArg> LocalizedMessage::args() const
+{
+    vector<LocalizationArg> result;
+    result.reserve(m_args.size());
+    for (size_t i = 0; i < m_args.size(); i++)
+        result.push_back(arg(i));
+    return result;
+}
+
+const string& LocalizedMessage::str() const
+{
+    const string lang = get_localization_language();
+    for (const auto& entry : m_rendered)
+    {
+        if (entry.first == lang)
+            return entry.second;
+    }
+
+    // (in lang, even if another thread has switched language since)
+    m_rendered.emplace_back(lang, localize_in(lang, args()));
+    return m_rendered.back().second;
+}
+
+string LocalizedMessage::sentence() const
+{
+    return uppercase_first(str());
+}
+
+bool LocalizedMessage::is_rendered() const
+{
+    const string lang = get_localization_language();
+    for (const auto& entry : m_rendered)
+    {
+        if (entry.first == lang)
+            return true;
+    }
+    return false;
+}
+
+void LocalizedMessage::clear_rendered() const
+{
+    m_rendered.clear();
+}
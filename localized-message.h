@@ -0,0 +1,109 @@
+/*
+ * localized-message.h
+ * A message whose localization is deferred until it is displayed
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+using std::string;
+
+#include <list>
+using std::list;
+
+#include <utility>
+using std::pair;
+
+#include <vector>
+using std::vector;
+
+#include "localize.h"
+
+/*
+ * Captures the arguments of a localize() call without translating or
+ * formatting anything. The text is only produced the first time str() is
+ * called, and is then cached for the language it was rendered in, so
+ * messages which are never looked at cost no more than a copy of their
+ * arguments.
+ *
+ * All the strings of all the args (format, domains, values, plurals) are
+ * packed into a single buffer, so a message makes two allocations rather
+ * than three per argument.
+ *
+ * The rendered cache is not thread-safe: str() is const but fills the
+ * cache, so don't call it (or is_rendered()/clear_rendered()) on the same
+ * message from several threads at once.
+ */
+class LocalizedMessage
+{
+public:
+    LocalizedMessage();
+    explicit LocalizedMessage(const vector<LocalizationArg>& args);
+    explicit LocalizedMessage(const LocalizationArg& arg);
+    LocalizedMessage(const LocalizationArg& arg1, const LocalizationArg& arg2);
+    LocalizedMessage(const LocalizationArg& arg1, const LocalizationArg& arg2,
+                     const LocalizationArg& arg3);
+
+    bool empty() const { return m_args.empty(); }
+
+    // number of args, including the format string
+    size_t size() const { return m_args.size(); }
+
+    void add_arg(const LocalizationArg& arg);
+
+    // rebuild the original args
+    LocalizationArg arg(size_t index) const;
+    vector<LocalizationArg> args() const;
+
+    // text in the current localization language (rendered on first use);
+    // the reference stays valid until clear_rendered() or destruction, even
+    // if the message is later rendered in other languages
+    const string& str() const;
+
+    // same, but with the first letter capitalized, as for localize_sentence()
+    string sentence() const;
+
+    // has this been rendered in the current localization language?
+    bool is_rendered() const;
+
+    // forget any rendered text (e.g. after the catalogs have been reloaded)
+    void clear_rendered() const;
+
+private:
+    // substring of m_strings
+    struct string_ref
+    {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    struct packed_arg
+    {
+        uint8_t type;       // LocalizationArgType
+        bool translate;
+        int count;
+        string_ref domain;
+        string_ref value;
+        string_ref plural;
+        union
+        {
+            int i;
+            long l;
+            long long ll;
+            double d;
+            long double ld;
+        } num;
+    };
+
+    string_ref _intern(const string& s);
+    string _get(const string_ref& ref) const;
+
+    string m_strings;
+    vector<packed_arg> m_args;
+
+    // (language, text) for each language this has been rendered in
+    // (a list, so that rendering another language doesn't move the text
+    // earlier str() calls returned)
+    mutable list<pair<string, string>> m_rendered;
+};
@@ -0,0 +1,335 @@
+/*
+ * message-log.cc
+ * Compact binary log of unrendered localize() calls
+ */
+
+#include "message-log.h"
+
+#include <cstring>
+using namespace std;
+
+static const uint8_t ARG_TYPE_MASK = 0x0f;
+static const uint8_t ARG_HAS_COUNT = 0x40;
+static const uint8_t ARG_TRANSLATE = 0x80;
+
+// string refs
+static const uint64_t STR_EMPTY = 0;
+static const uint64_t STR_NEW = 1;
+static const uint64_t STR_FIRST_INDEX = 2;
+
+// don't trust lengths from a corrupt stream
+static const uint64_t MAX_STRING_LENGTH = 1 << 20;
+static const uint64_t MAX_ARGS = 1 << 10;
+
+//// writer ////
+
+MessageLogWriter::MessageLogWriter(ostream& out)
+    : m_out(out), m_bytes(0)
+{
+    for (const char* c = MESSAGE_LOG_MAGIC; *c; c++)
+        _put_byte(*c);
+    _put_byte(MESSAGE_LOG_VERSION);
+}
+
+void MessageLogWriter::_put_byte(uint8_t b)
+{
+    m_out.put(static_cast<char>(b));
+    ++m_bytes;
+}
+
+void MessageLogWriter::_put_varint(uint64_t val)
+{
+    while (val >= 0x80)
+    {
+        _put_byte(static_cast<uint8_t>(val) | 0x80);
+        val >>= 7;
+    }
+    _put_byte(static_cast<uint8_t>(val));
+}
+
+// zigzag encoding, so small negative numbers stay small
+void MessageLogWriter::_put_signed(int64_t val)
+{
+    _put_varint((static_cast<uint64_t>(val) << 1) ^ static_cast<uint64_t>(val >> 63));
+}
+
+void MessageLogWriter::_put_double(double val)
+{
+    uint64_t bits;
+    memcpy(&bits, &val, sizeof(bits));
+    for (int i = 0; i < 8; i++)
+        _put_byte(static_cast<uint8_t>(bits >> (8 * i)));
+}
+
+void MessageLogWriter::_put_string(const string& s)
+{
+    if (s.empty())
+    {
+        _put_varint(STR_EMPTY);
+        return;
+    }
+
+    auto it = m_strings.find(s);
+    if (it != m_strings.end())
+    {
+        _put_varint(STR_FIRST_INDEX + it->second);
+        return;
+    }
+
+    const uint64_t index = m_strings.size();
+    m_strings[s] = index;
+    _put_varint(STR_NEW);
+    _put_varint(s.length());
+    m_out.write(s.data(), s.length());
+    m_bytes += s.length();
+}
+
+void MessageLogWriter::_put_arg(const LocalizationArg& arg)
+{
+    uint8_t flags = static_cast<uint8_t>(arg.type) & ARG_TYPE_MASK;
+    if (arg.translate)
+        flags |= ARG_TRANSLATE;
+    if (arg.count != 1)
+        flags |= ARG_HAS_COUNT;
+    _put_byte(flags);
+
+    switch (arg.type)
+    {
+    case LOC_ARG_STRING:
+        _put_string(arg.domain);
+        _put_string(arg.stringVal);
+        _put_string(arg.plural);
+        break;
+    case LOC_ARG_INT:
+        _put_signed(arg.intVal);
+        break;
+    case LOC_ARG_LONG:
+        _put_signed(arg.longVal);
+        break;
+    case LOC_ARG_LONG_LONG:
+        _put_signed(arg.longLongVal);
+        break;
+    case LOC_ARG_DOUBLE:
+        _put_double(arg.doubleVal);
+        break;
+    case LOC_ARG_LONG_DOUBLE:
+    {
+        // not all platforms agree on the layout of long double
+        const double high = static_cast<double>(arg.longDoubleVal);
+        _put_double(high);
+        _put_double(static_cast<double>(arg.longDoubleVal - high));
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (flags & ARG_HAS_COUNT)
+        _put_signed(arg.count);
+}
+
+void MessageLogWriter::write(const vector<LocalizationArg>& args)
+{
+    _put_varint(args.size());
+    for (const LocalizationArg& arg : args)
+        _put_arg(arg);
+}
+
+void MessageLogWriter::write(const LocalizedMessage& msg)
+{
+    _put_varint(msg.size());
+    for (size_t i = 0; i < msg.size(); i++)
+        _put_arg(msg.arg(i));
+}
+
+//// reader ////
+
+MessageLogReader::MessageLogReader(istream& in)
+    : m_in(in), m_valid(true)
+{
+    for (const char* c = MESSAGE_LOG_MAGIC; *c && m_valid; c++)
+    {
+        uint8_t b;
+        m_valid = _get_byte(b) && b == static_cast<uint8_t>(*c);
+    }
+
+    uint8_t version;
+    m_valid = m_valid && _get_byte(version) && version == MESSAGE_LOG_VERSION;
+}
+
+bool MessageLogReader::_get_byte(uint8_t& b)
+{
+    const int c = m_in.get();
+    if (c == EOF)
+        return false;
+    b = static_cast<uint8_t>(c);
+    return true;
+}
+
+bool MessageLogReader::_get_varint(uint64_t& val)
+{
+    val = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        uint8_t b;
+        if (!_get_byte(b))
+            return false;
+        val |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return true;
+    }
+    return false;
+}
+
+bool MessageLogReader::_get_signed(int64_t& val)
+{
+    uint64_t zigzag;
+    if (!_get_varint(zigzag))
+        return false;
+    val = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+    return true;
+}
+
+bool MessageLogReader::_get_double(double& val)
+{
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        uint8_t b;
+        if (!_get_byte(b))
+            return false;
+        bits |= static_cast<uint64_t>(b) << (8 * i);
+    }
+    memcpy(&val, &bits, sizeof(val));
+    return true;
+}
+
+bool MessageLogReader::_get_string(string& s)
+{
+    uint64_t ref;
+    if (!_get_varint(ref))
+        return false;
+
+    if (ref == STR_EMPTY)
+    {
+        s.clear();
+        return true;
+    }
+    else if (ref == STR_NEW)
+    {
+        uint64_t len;
+        if (!_get_varint(len) || len > MAX_STRING_LENGTH)
+            return false;
+        s.resize(len);
+        if (!m_in.read(&s[0], len))
+            return false;
+        m_strings.push_back(s);
+        return true;
+    }
+
+    const uint64_t index = ref - STR_FIRST_INDEX;
+    if (index >= m_strings.size())
+        return false;
+    s = m_strings[index];
+    return true;
+}
+
+bool MessageLogReader::_get_arg(LocalizationArg& arg)
+{
+    uint8_t flags;
+    if (!_get_byte(flags))
+        return false;
+
+    bool ok = true;
+    int64_t i;
+    double d;
+    switch (flags & ARG_TYPE_MASK)
+    {
+    case LOC_ARG_NONE:
+        arg = LocalizationArg();
+        break;
+    case LOC_ARG_STRING:
+    {
+        string domain, value, plural;
+        ok = _get_string(domain) && _get_string(value) && _get_string(plural);
+        arg = LocalizationArg(domain, value, plural, 1);
+        break;
+    }
+    case LOC_ARG_INT:
+        ok = _get_signed(i);
+        arg = LocalizationArg(static_cast<int>(i));
+        break;
+    case LOC_ARG_LONG:
+        ok = _get_signed(i);
+        arg = LocalizationArg(static_cast<long>(i));
+        break;
+    case LOC_ARG_LONG_LONG:
+        ok = _get_signed(i);
+        arg = LocalizationArg(static_cast<long long>(i));
+        break;
+    case LOC_ARG_DOUBLE:
+        ok = _get_double(d);
+        arg = LocalizationArg(d);
+        break;
+    case LOC_ARG_LONG_DOUBLE:
+    {
+        double low;
+        ok = _get_double(d) && _get_double(low);
+        arg = LocalizationArg(static_cast<long double>(d) + low);
+        break;
+    }
+    default:
+        // unknown type
+        return false;
+    }
+
+    if (ok && (flags & ARG_HAS_COUNT))
+    {
+        ok = _get_signed(i);
+        arg.count = static_cast<int>(i);
+    }
+    arg.translate = (flags & ARG_TRANSLATE) != 0;
+    return ok;
+}
+
+bool MessageLogReader::read(vector<LocalizationArg>& args)
+{
+    args.clear();
+    if (!m_valid)
+        return false;
+
+    uint64_t nargs;
+    if (!_get_varint(nargs) || nargs > MAX_ARGS)
+        return false;
+
+    args.resize(nargs);
+    for (LocalizationArg& arg : args)
+    {
+        if (!_get_arg(arg))
+        {
+            // can't resynchronise after a bad record
+            m_valid = false;
+            args.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MessageLogReader::read(LocalizedMessage& msg)
+{
+    vector<LocalizationArg> args;
+    if (!read(args))
+        return false;
+    msg = LocalizedMessage(args);
+    return true;
+}
+
+bool MessageLogReader::read_rendered(string& text)
+{
+    vector<LocalizationArg> args;
+    if (!read(args))
+        return false;
+    text = localize(args);
+    return true;
+}
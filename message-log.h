@@ -0,0 +1,98 @@
+/*
+ * message-log.h
+ * Compact binary log of unrendered localize() calls
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+using std::istream;
+using std::ostream;
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+#include "localize.h"
+#include "localized-message.h"
+
+/*
+ * Stream layout:
+ *
+ *   header:  "XLML" version(1 byte)
+ *   record:  nargs(varint) arg...
+ *   arg:     flags(1 byte) payload
+ *
+ * The low 4 bits of the flags byte are the LocalizationArgType, 0x80 means
+ * the arg is to be translated and 0x40 means a count follows the payload.
+ * String payloads are domain, value and plural as string refs. Integers are
+ * zigzag varints; doubles are 8 bytes, long doubles two doubles (high part
+ * then the remainder).
+ *
+ * Strings are interned per stream. A string ref is a varint: 0 for the empty
+ * string, 1 for a new string (followed by its length and bytes), otherwise
+ * 2 + the index of a string already seen in this stream. So a format string
+ * or monster name only appears in full the first time it is logged.
+ *
+ * Nothing is translated on the way in, so a log can be rendered into any
+ * language for which catalogs are loaded.
+ */
+
+#define MESSAGE_LOG_MAGIC "XLML"
+#define MESSAGE_LOG_VERSION 1
+
+class MessageLogWriter
+{
+public:
+    MessageLogWriter(ostream& out);
+
+    void write(const vector<LocalizationArg>& args);
+    void write(const LocalizedMessage& msg);
+
+    // bytes written so far, including the header
+    size_t bytes_written() const { return m_bytes; }
+
+private:
+    void _put_byte(uint8_t b);
+    void _put_varint(uint64_t val);
+    void _put_signed(int64_t val);
+    void _put_double(double val);
+    void _put_string(const string& s);
+    void _put_arg(const LocalizationArg& arg);
+
+    ostream& m_out;
+    size_t m_bytes;
+    unordered_map<string, uint64_t> m_strings;
+};
+
+class MessageLogReader
+{
+public:
+    MessageLogReader(istream& in);
+
+    // false if the stream doesn't start with a valid header
+    bool valid() const { return m_valid; }
+
+    // decode the next record; false at end of stream or on corrupt data
+    bool read(vector<LocalizationArg>& args);
+    bool read(LocalizedMessage& msg);
+
+    // decode the next record and localize() it in the current language
+    bool read_rendered(string& text);
+
+private:
+    bool _get_byte(uint8_t& b);
+    bool _get_varint(uint64_t& val);
+    bool _get_signed(int64_t& val);
+    bool _get_double(double& val);
+    bool _get_string(string& s);
+    bool _get_arg(LocalizationArg& arg);
+
+    istream& m_in;
+    bool m_valid;
+    vector<string> m_strings;
+};
@@ -0,0 +1,321 @@
+/**
+ * @file
+ * @brief Compact binary encoding of monster_info, for streaming monster
+ *        lists to clients which render the names themselves.
+**/
+
+#include "AppHdr.h"
+
+#include "monsters-inc.h" //XLATE_POC
+#include "mon-info-codec.h"
+
+static void _put_varint(uint64_t value, string &out)
+{
+    while (value >= 0x80)
+    {
+        out += (char)((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    out += (char)value;
+}
+
+// zigzag, so that small negative numbers are small too
+static void _put_signed(int64_t value, string &out)
+{
+    _put_varint((uint64_t)value << 1 ^ (uint64_t)(value >> 63), out);
+}
+
+static bool _get_varint(string_view data, size_t &pos, uint64_t &value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64 && pos < data.size(); shift += 7)
+    {
+        const uint8_t byte = data[pos++];
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+static bool _get_signed(string_view data, size_t &pos, int64_t &value)
+{
+    uint64_t raw;
+    if (!_get_varint(data, pos, raw))
+        return false;
+    value = (int64_t)(raw >> 1) ^ -(int64_t)(raw & 1);
+    return true;
+}
+
+// only the words which aren't zero, after a mask of which those are
+static void _put_flags(const FixedBitVector<NUM_MB_FLAGS> &bits, string &out)
+{
+    uint64_t present = 0;
+    for (unsigned int w = 0; w < bits.num_words(); w++)
+        if (bits.get_word(w))
+            present |= uint64_t(1) << w;
+    _put_varint(present, out);
+    for (unsigned int w = 0; w < bits.num_words(); w++)
+        if (bits.get_word(w))
+            _put_varint(bits.get_word(w), out);
+}
+
+static bool _get_flags(string_view data, size_t &pos,
+                       FixedBitVector<NUM_MB_FLAGS> &bits)
+{
+    uint64_t present;
+    if (!_get_varint(data, pos, present)
+        || present >> bits.num_words())
+    {
+        return false;
+    }
+    for (unsigned int w = 0; w < bits.num_words(); w++)
+    {
+        uint64_t word = 0;
+        if (present >> w & 1 && !_get_varint(data, pos, word))
+            return false;
+        bits.set_word(w, word);
+    }
+    return true;
+}
+
+static FixedBitVector<NUM_MB_FLAGS> _flipped(
+    const FixedBitVector<NUM_MB_FLAGS> &a,
+    const FixedBitVector<NUM_MB_FLAGS> &b)
+{
+    FixedBitVector<NUM_MB_FLAGS> res;
+    for (unsigned int w = 0; w < a.num_words(); w++)
+        res.set_word(w, a.get_word(w) ^ b.get_word(w));
+    return res;
+}
+
+uint32_t monster_info_encoder::_intern(const string &name, string &out)
+{
+    auto found = names.find(name);
+    if (found != names.end())
+    {
+        _put_varint(found->second, out);
+        return found->second;
+    }
+
+    const uint32_t id = names.size();
+    names[name] = id;
+    _put_varint(id, out);
+    _put_varint(name.size(), out);
+    out += name;
+    return id;
+}
+
+bool monster_info_encoder::encode(const monster_info &mi, string &out)
+{
+    monster_wire_state now;
+    now.pos = mi.pos;
+    now.type = mi.type;
+    now.base_type = mi.base_type;
+    now.number = mi.number;
+    now.colour = mi._colour;
+    now.attitude = mi.attitude;
+    now.threat = mi.threat;
+    now.dam = mi.dam;
+    now.mb = mi.mb;
+
+    // A new monster, or a new kind of monster, is sent in full.
+    unsigned fields = MWF_ALL;
+    auto prev = sent.find(mi.client_id);
+    const bool delta = prev != sent.end()
+                       && prev->second.type == now.type
+                       && prev->second.base_type == now.base_type;
+    if (delta)
+    {
+        const monster_wire_state &old = prev->second;
+        auto name = names.find(mi.mname);
+        fields = 0;
+        if (old.pos != now.pos)
+            fields |= MWF_POS;
+        if (old.number != now.number)
+            fields |= MWF_NUMBER;
+        if (old.colour != now.colour)
+            fields |= MWF_COLOUR;
+        if (old.attitude != now.attitude)
+            fields |= MWF_ATTITUDE;
+        if (old.threat != now.threat)
+            fields |= MWF_THREAT;
+        if (old.dam != now.dam)
+            fields |= MWF_DAMAGE;
+        if (old.mb != now.mb)
+            fields |= MWF_FLAGS;
+        if (name == names.end() || name->second != old.name)
+            fields |= MWF_NAME;
+        if (!fields)
+            return false;
+        now.name = old.name;
+    }
+
+    _put_varint((uint64_t)mi.client_id << 1, out);
+    _put_varint(fields, out);
+    if (fields & MWF_POS)
+    {
+        _put_signed(now.pos.x, out);
+        _put_signed(now.pos.y, out);
+    }
+    if (fields & MWF_TYPE)
+    {
+        _put_varint(now.type, out);
+        _put_varint(now.base_type, out);
+    }
+    if (fields & MWF_NUMBER)
+        _put_varint(now.number, out);
+    if (fields & MWF_COLOUR)
+        _put_signed(now.colour, out);
+    if (fields & MWF_ATTITUDE)
+        _put_varint(now.attitude, out);
+    if (fields & MWF_THREAT)
+        _put_varint(now.threat, out);
+    if (fields & MWF_DAMAGE)
+        _put_varint(now.dam, out);
+    if (fields & MWF_FLAGS)
+        _put_flags(delta ? _flipped(prev->second.mb, now.mb) : now.mb, out);
+    if (fields & MWF_NAME)
+        now.name = _intern(mi.mname, out);
+
+    sent[mi.client_id] = now;
+    return true;
+}
+
+void monster_info_encoder::encode_gone(uint32_t id, string &out)
+{
+    _put_varint((uint64_t)id << 1 | 1, out);
+    sent.erase(id);
+}
+
+void monster_info_encoder::reset()
+{
+    sent.clear();
+    names.clear();
+}
+
+bool monster_info_decoder::decode(string_view data, size_t &pos)
+{
+    size_t p = pos;
+    uint64_t header, fields;
+    if (!_get_varint(data, p, header) || header >> 33)
+        return false;
+
+    const uint32_t id = header >> 1;
+    auto prev = known.find(id);
+    if (header & 1)
+    {
+        if (prev == known.end())
+            return false;
+        known.erase(prev);
+        pos = p;
+        return true;
+    }
+
+    if (!_get_varint(data, p, fields) || fields & ~(uint64_t)MWF_ALL
+        || (prev == known.end() && fields != MWF_ALL))
+    {
+        return false;
+    }
+
+    // Read everything before changing anything.
+    int64_t x = 0, y = 0, colour = 0;
+    uint64_t type = 0, base_type = 0, number = 0;
+    uint64_t attitude = 0, threat = 0, dam = 0, name = 0;
+    FixedBitVector<NUM_MB_FLAGS> flags;
+    string new_name;
+    if (fields & MWF_POS
+        && (!_get_signed(data, p, x) || !_get_signed(data, p, y)))
+    {
+        return false;
+    }
+    if (fields & MWF_TYPE
+        && (!_get_varint(data, p, type) || type >= NUM_MONSTERS
+            || !_get_varint(data, p, base_type) || base_type >= NUM_MONSTERS))
+    {
+        return false;
+    }
+    if (fields & MWF_NUMBER
+        && (!_get_varint(data, p, number) || number > UINT32_MAX))
+    {
+        return false;
+    }
+    if (fields & MWF_COLOUR && !_get_signed(data, p, colour))
+        return false;
+    if (fields & MWF_ATTITUDE
+        && (!_get_varint(data, p, attitude) || attitude > ATT_FRIENDLY))
+    {
+        return false;
+    }
+    if (fields & MWF_THREAT
+        && (!_get_varint(data, p, threat) || threat > MTHRT_UNDEF))
+    {
+        return false;
+    }
+    if (fields & MWF_DAMAGE
+        && (!_get_varint(data, p, dam) || dam > MDAM_DEAD))
+    {
+        return false;
+    }
+    if (fields & MWF_FLAGS && !_get_flags(data, p, flags))
+        return false;
+    if (fields & MWF_NAME)
+    {
+        uint64_t length;
+        if (!_get_varint(data, p, name) || name > names.size())
+            return false;
+        if (name == names.size())
+        {
+            if (!_get_varint(data, p, length) || length > data.size() - p)
+                return false;
+            new_name = string(data.substr(p, length));
+            p += length;
+        }
+    }
+
+    // A new kind of monster starts from what its class implies, so that
+    // the client can describe it.
+    monster_info &mi = fields & MWF_TYPE
+        ? known[id] = monster_info((monster_type)type, (monster_type)base_type)
+        : prev->second;
+    if (fields & MWF_TYPE)
+    {
+        mi.client_id = id;
+        mi.mb.reset();
+    }
+    if (fields & MWF_POS)
+        mi.pos = coord_def(x, y);
+    if (fields & MWF_NUMBER)
+        mi.number = number;
+    if (fields & MWF_COLOUR)
+        mi._colour = colour;
+    if (fields & MWF_ATTITUDE)
+        mi.attitude = (mon_attitude_type)attitude;
+    if (fields & MWF_THREAT)
+        mi.threat = (mon_threat_level_type)threat;
+    if (fields & MWF_DAMAGE)
+        mi.dam = (mon_dam_level_type)dam;
+    if (fields & MWF_FLAGS)
+        mi.mb = _flipped(mi.mb, flags);
+    if (fields & MWF_NAME)
+    {
+        if (name == names.size())
+            names.push_back(new_name);
+        mi.mname = names[name];
+    }
+
+    pos = p;
+    return true;
+}
+
+const monster_info *monster_info_decoder::find(uint32_t id) const
+{
+    auto found = known.find(id);
+    return found == known.end() ? nullptr : &found->second;
+}
+
+void monster_info_decoder::reset()
+{
+    known.clear();
+    names.clear();
+}
@@ -0,0 +1,101 @@
+/**
+ * @file
+ * @brief Compact binary encoding of monster_info, for streaming monster
+ *        lists to clients which render the names themselves.
+ *
+ * A stream is a series of records, each one monster:
+ *
+ *   varint  client_id * 2 + gone
+ *   varint  fields present (monster_wire_field bits), unless gone
+ *   ...     those fields, in bit order
+ *
+ * Numbers are LEB128 varints, signed ones zigzagged first. The status
+ * flags are a varint mask of the non-zero 64-bit words followed by those
+ * words as varints. Names are interned: a varint index into the names
+ * seen so far this session, where the next unused index is followed by
+ * the new name's length and bytes.
+ *
+ * Encoder and decoder both remember the last state of each monster, so
+ * after the first record only the fields which changed are sent, with the
+ * flags as the bits which flipped. Everything else (hit dice, resists,
+ * the English names) comes from the type on the client.
+**/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "mon-info.h"
+
+using std::string;
+using std::string_view;
+
+enum monster_wire_field
+{
+    MWF_POS      = 1 << 0,
+    MWF_TYPE     = 1 << 1, // type and base type; the decoder starts afresh
+    MWF_NUMBER   = 1 << 2,
+    MWF_COLOUR   = 1 << 3,
+    MWF_ATTITUDE = 1 << 4,
+    MWF_THREAT   = 1 << 5,
+    MWF_DAMAGE   = 1 << 6,
+    MWF_FLAGS    = 1 << 7,
+    MWF_NAME     = 1 << 8,
+    MWF_ALL      = (1 << 9) - 1,
+};
+
+// What's sent of a monster_info, as both ends last saw it.
+struct monster_wire_state
+{
+    coord_def pos;
+    monster_type type;
+    monster_type base_type;
+    unsigned number;
+    int colour;
+    mon_attitude_type attitude;
+    mon_threat_level_type threat;
+    mon_dam_level_type dam;
+    FixedBitVector<NUM_MB_FLAGS> mb;
+    uint32_t name;      // interned mname
+};
+
+class monster_info_encoder
+{
+public:
+    // Append mi: in full the first time, then just what has changed.
+    // Returns false, appending nothing, if nothing has.
+    bool encode(const monster_info &mi, string &out);
+
+    // Append that the monster has gone, forgetting it at both ends.
+    void encode_gone(uint32_t id, string &out);
+
+    // A new session: the client knows no monsters or names.
+    void reset();
+
+private:
+    uint32_t _intern(const string &name, string &out);
+
+    std::unordered_map<uint32_t, monster_wire_state> sent;
+    std::unordered_map<string, uint32_t> names;
+};
+
+class monster_info_decoder
+{
+public:
+    // Read one record from data at pos, moving pos past it. Returns false
+    // (leaving what's known as it was) if the record is malformed or
+    // refers to a monster or name it hasn't seen.
+    bool decode(string_view data, size_t &pos);
+
+    // The monster as last decoded, or nullptr if it's gone or unknown.
+    const monster_info *find(uint32_t id) const;
+
+    void reset();
+
+private:
+    std::unordered_map<uint32_t, monster_info> known;
+    std::vector<string> names;
+};
@@ -11,7 +11,9 @@
 #include "mon-info.h"
 
 #include <algorithm>
+#include <array>
 #include <sstream>
+#include <unordered_map>
 
 #if NOT_XLATE_POC
 #include "act-iter.h"
@@ -218,6 +220,15 @@ static bool _is_public_key(string key)
     return false;
 }
 
+// The public keys which names and pronouns use.
+static const char * const _name_keys[] =
+{
+    "helpless",
+    MUTANT_BEAST_FACETS,
+    MUTANT_BEAST_TIER,
+    MON_GENDER_KEY,
+};
+
 static int quantise(int value, int stepsize)
 {
     return value + stepsize - value % stepsize;
@@ -308,8 +319,8 @@ static void _translate_tentacle_ref(monster_info& mi, const monster* m,
 /// is the given monster_info a hydra, zombie hydra, lerny, etc?
 static bool _is_hydra(const monster_info &mi)
 {
-    return mons_genus(mi.type) == MONS_HYDRA
-           || mons_genus(mi.base_type) == MONS_HYDRA;
+    return mons_class_has_trait(mi.type, mct_bit(MCT_HYDRA))
+           || mons_class_has_trait(mi.base_type, mct_bit(MCT_HYDRA));
 }
 
 
@@ -439,9 +450,18 @@ static description_level_type _article_for(const actor* a)
 #endif
 
 monster_info::monster_info(const monster* m, int milev)
+{
+    init(m, milev);
+}
+
+/**
+ * Fill in this info for m, as the constructor does, but reusing the
+ * storage already here: strings and vectors keep their capacity.
+ */
+void monster_info::init(const monster* m, int milev)
 {
     ASSERT(m); // TODO: change to const monster &mon
-    mb.reset();
+    _clear();
     attitude = ATT_HOSTILE;
 #if NOT_XLATE_POC
     pos = m->pos();
@@ -451,17 +471,27 @@ monster_info::monster_info(const monster* m, int milev)
     type = m->type;
     threat = mons_threat_level(*m);
 
-    props.clear();
     // CrawlHashTable::begin() const can fail if the hash is empty.
     if (!m->props.empty())
     {
-        for (const auto &entry : m->props)
-            if (_is_public_key(entry.first))
-                props[entry.first] = entry.second;
+        if (milev <= MILEV_NAME)
+        {
+            // Names only need a handful of keys: look those up, rather
+            // than copying everything public.
+            for (const char *key : _name_keys)
+                if (m->props.exists(key))
+                    props[key] = m->props[key];
+        }
+        else
+        {
+            for (const auto &entry : m->props)
+                if (_is_public_key(entry.first))
+                    props[entry.first] = entry.second;
+        }
     }
 
     // Translate references to tentacles into just their locations
-    if (mons_is_tentacle_or_tentacle_segment(type))
+    if (milev > MILEV_NAME && mons_is_tentacle_or_tentacle_segment(type))
     {
         _translate_tentacle_ref(*this, m, "inwards");
         _translate_tentacle_ref(*this, m, "outwards");
@@ -790,6 +820,140 @@ monster_info::monster_info(const monster* m, int milev)
 #endif
 }
 
+// Empty whatever init() only fills in for some monsters, keeping the
+// storage.
+void monster_info::_clear()
+{
+    mb.reset();
+    mname.clear();
+    description.clear();
+    quote.clear();
+    constrictor_name.clear();
+    constricting_name.clear();
+    for (auto &item : inv)
+        item.reset();
+#if NOT_XLATE_POC
+    props.clear();
+    spells.clear();
+#endif
+    client_id = 0;
+}
+
+monster_info &monster_info_pool::acquire(const monster *m, int milev)
+{
+    if (used == infos.size())
+        infos.emplace_back(m, milev);
+    else
+        infos[used].init(m, milev);
+    return infos[used++];
+}
+
+unsigned monster_info_changes(const monster_info &old_mi,
+                              const monster_info &new_mi)
+{
+    unsigned changes = MIC_NONE;
+    if (old_mi.pos != new_mi.pos)
+        changes |= MIC_POS;
+    if (old_mi.mb != new_mi.mb)
+        changes |= MIC_FLAGS;
+    if (old_mi.attitude != new_mi.attitude)
+        changes |= MIC_ATTITUDE;
+    if (old_mi.threat != new_mi.threat)
+        changes |= MIC_THREAT;
+    if (old_mi.dam != new_mi.dam)
+        changes |= MIC_DAMAGE;
+    if (old_mi.type != new_mi.type
+        || old_mi.base_type != new_mi.base_type
+        || old_mi.number != new_mi.number
+        || old_mi.mname != new_mi.mname)
+    {
+        changes |= MIC_NAME;
+    }
+    if (old_mi._colour != new_mi._colour)
+        changes |= MIC_COLOUR;
+    return changes;
+}
+
+int monster_list::_index_of(uint32_t id) const
+{
+    for (size_t i = 0; i < list.size(); i++)
+        if (list[i].client_id == id)
+            return i;
+    return -1;
+}
+
+// Insert mi after any equal infos, returning where it went.
+int monster_list::_insert(monster_info &&mi)
+{
+    auto pos = upper_bound(list.begin(), list.end(), mi, less_than);
+    const int index = pos - list.begin();
+    list.insert(pos, move(mi));
+    return index;
+}
+
+void monster_list::update(vector<monster_info> &infos,
+                          vector<monster_list_delta> &deltas)
+{
+    unordered_map<uint32_t, monster_info *> incoming;
+    incoming.reserve(infos.size());
+    for (monster_info &mi : infos)
+        incoming[mi.client_id] = &mi;
+
+    // Gone: from the back, so that each index is right when it's applied.
+    for (int i = (int)list.size() - 1; i >= 0; i--)
+    {
+        const uint32_t id = list[i].client_id;
+        if (!incoming.count(id))
+        {
+            deltas.push_back({ MLD_REMOVE, id, i, i, MIC_NONE });
+            list.erase(list.begin() + i);
+        }
+    }
+
+    // Still here: always take the new info, but only move it if it no
+    // longer sorts where it is, and only report it if anything listed
+    // changed. (The order only depends on fields which are compared.)
+    vector<uint32_t> staying;
+    for (const monster_info &mi : list)
+        staying.push_back(mi.client_id);
+    for (uint32_t id : staying)
+    {
+        auto entry = incoming.find(id);
+        monster_info &mi = *entry->second;
+        incoming.erase(entry);
+
+        const int i = _index_of(id);
+        const unsigned changes = monster_info_changes(list[i], mi);
+        const int last = (int)list.size() - 1;
+        if (!changes
+            || ((i == 0 || !less_than(mi, list[i - 1]))
+                && (i == last || !less_than(list[i + 1], mi))))
+        {
+            list[i] = move(mi);
+            if (changes)
+                deltas.push_back({ MLD_UPDATE, id, i, i, changes });
+        }
+        else
+        {
+            list.erase(list.begin() + i);
+            const int index = _insert(move(mi));
+            deltas.push_back({ MLD_UPDATE, id, index, i, changes });
+        }
+    }
+
+    // New
+    for (monster_info &mi : infos)
+    {
+        const uint32_t id = mi.client_id;
+        if (incoming.erase(id))
+        {
+            const int index = _insert(move(mi));
+            deltas.push_back({ MLD_INSERT, id, index, index, MIC_NONE });
+        }
+    }
+    infos.clear();
+}
+
 #if NOT_XLATE_POC
 /// Player-known max HP information for a monster: "about 55", "243".
 string monster_info::get_max_hp_desc() const
@@ -1230,63 +1394,77 @@ bool monster_info::less_than(const monster_info& m1, const monster_info& m2,
     return false;
 }
 
-static string _verbose_info0(const monster_info& mi)
-{
-    if (mi.is(MB_BERSERK))
-        return "berserk";
-    if (mi.is(MB_INSANE))
-        return "insane";
-    if (mi.is(MB_INNER_FLAME))
-        return "inner flame";
-    if (mi.is(MB_DUMB))
-        return "stupefied";
-    if (mi.is(MB_PARALYSED))
-        return "paralysed";
-    if (mi.is(MB_CAUGHT))
-        return "caught";
-    if (mi.is(MB_WEBBED))
-        return "webbed";
-    if (mi.is(MB_PETRIFIED))
-        return "petrified";
-    if (mi.is(MB_PINNED))
-        return "pinned";
-    if (mi.is(MB_PETRIFYING))
-        return "petrifying";
-    if (mi.is(MB_MAD))
-        return "mad";
-    if (mi.is(MB_CONFUSED))
-        return "confused";
-    if (mi.is(MB_FLEEING))
-        return "fleeing";
-    if (mi.is(MB_DORMANT))
-        return "dormant";
-    if (mi.is(MB_SLEEPING))
-        return "sleeping";
-    if (mi.is(MB_UNAWARE))
-        return "unaware";
-    if (mi.is(MB_DAZED))
-        return "dazed";
-    if (mi.is(MB_MUTE))
-        return "mute";
-    if (mi.is(MB_BLIND))
-        return "blind";
-    // avoid jelly (wandering) (fellow slime)
-    if (mi.is(MB_WANDERING) && mi.attitude != ATT_STRICT_NEUTRAL)
-        return "wandering";
-    if (mi.is(MB_BURNING))
-        return "burning";
-    if (mi.is(MB_INVISIBLE))
-        return "invisible";
-
-    return "";
+struct mb_description
+{
+    monster_info_flags flag;
+    const char *desc;   // English, and the msgid for translation
+};
+
+// For each flag, 1 + its index in list, or 0 if it isn't there.
+template <size_t N>
+static constexpr array<uint8_t, NUM_MB_FLAGS>
+_index_by_flag(const mb_description (&list)[N])
+{
+    static_assert(N < 256, "too many descriptions to index");
+    array<uint8_t, NUM_MB_FLAGS> index {};
+    for (size_t i = 0; i < N; i++)
+        if (!index[list[i].flag])
+            index[list[i].flag] = i + 1;
+    return index;
+}
+
+// Most important first: only the first one which is set is shown.
+static constexpr mb_description _verbose_list[] =
+{
+    { MB_BERSERK,     "berserk" },
+    { MB_INSANE,      "insane" },
+    { MB_INNER_FLAME, "inner flame" },
+    { MB_DUMB,        "stupefied" },
+    { MB_PARALYSED,   "paralysed" },
+    { MB_CAUGHT,      "caught" },
+    { MB_WEBBED,      "webbed" },
+    { MB_PETRIFIED,   "petrified" },
+    { MB_PINNED,      "pinned" },
+    { MB_PETRIFYING,  "petrifying" },
+    { MB_MAD,         "mad" },
+    { MB_CONFUSED,    "confused" },
+    { MB_FLEEING,     "fleeing" },
+    { MB_DORMANT,     "dormant" },
+    { MB_SLEEPING,    "sleeping" },
+    { MB_UNAWARE,     "unaware" },
+    { MB_DAZED,       "dazed" },
+    { MB_MUTE,        "mute" },
+    { MB_BLIND,       "blind" },
+    { MB_WANDERING,   "wandering" },
+    { MB_BURNING,     "burning" },
+    { MB_INVISIBLE,   "invisible" },
+};
+
+static constexpr array<uint8_t, NUM_MB_FLAGS> _verbose_index
+    = _index_by_flag(_verbose_list);
+
+static const char *_verbose_info0(const monster_info& mi)
+{
+    unsigned int best = 0;
+    mi.mb.for_each_set([&](unsigned int flag)
+    {
+        const unsigned int pos = _verbose_index[flag];
+        // avoid jelly (wandering) (fellow slime)
+        if (flag == MB_WANDERING && mi.attitude == ATT_STRICT_NEUTRAL)
+            return;
+        if (pos && (!best || pos < best))
+            best = pos;
+    });
+
+    return best ? _verbose_list[best - 1].desc : "";
 }
 
 static string _verbose_info(const monster_info& mi)
 {
-    string inf = _verbose_info0(mi);
-    if (!inf.empty())
-        inf = " (" + inf + ")";
-    return inf;
+    const char *inf = _verbose_info0(mi);
+    if (!*inf)
+        return "";
+    return string(" (") + inf + ")";
 }
 
 string monster_info::pluralised_name(bool fullname) const
@@ -1298,14 +1476,14 @@ string monster_info::pluralised_name(bool fullname) const
     if (mons_is_unique(type) && type != MONS_MARA)
         return common_name();
     else if (mons_genus(type) == MONS_DRACONIAN)
-        return pluralise_monster(mons_type_name(MONS_DRACONIAN, DESC_PLAIN));
+        return mons_name_forms(MONS_DRACONIAN).plural;
     else if (mons_genus(type) == MONS_DEMONSPAWN)
-        return pluralise_monster(mons_type_name(MONS_DEMONSPAWN, DESC_PLAIN));
+        return mons_name_forms(MONS_DEMONSPAWN).plural;
     else if (type == MONS_UGLY_THING || type == MONS_VERY_UGLY_THING
              || type == MONS_DANCING_WEAPON || type == MONS_SPECTRAL_WEAPON
              || type == MONS_MUTANT_BEAST || !fullname)
     {
-        return pluralise_monster(mons_type_name(type, DESC_PLAIN));
+        return mons_name_forms(type).plural;
     }
     else
         return pluralise_monster(common_name());
@@ -1417,169 +1595,131 @@ void monster_info::to_string(int count, string& desc, int& desc_colour,
     desc = out.str();
 }
 
-vector<string> monster_info::attributes() const
+// The rest of attributes(), in the order they're listed. "%s" is the
+// monster's possessive pronoun.
+static constexpr mb_description _attribute_list[] =
 {
-    vector<string> v;
+    { MB_POISONED,          "poisoned" },
+    { MB_SICK,              "sick" },
+    { MB_GLOWING,           "softly glowing" },
+    { MB_INSANE,            "frenzied and insane" },
+    { MB_CONFUSED,          "confused" },
+    { MB_PINNED,            "pinned by a whirlwind" },
+    { MB_INVISIBLE,         "slightly transparent" },
+    { MB_CHARMED,           "in your thrall" },
+    { MB_BURNING,           "covered in liquid flames" },
+    { MB_CAUGHT,            "entangled in a net" },
+    { MB_WEBBED,            "entangled in a web" },
+    { MB_PETRIFIED,         "petrified" },
+    { MB_PETRIFYING,        "slowly petrifying" },
+    { MB_VULN_MAGIC,        "susceptible to hostile enchantments" },
+    { MB_SWIFT,             "covering ground quickly" },
+    { MB_SILENCING,         "radiating silence" },
+    { MB_PARALYSED,         "paralysed" },
+    { MB_REPEL_MSL,         "repelling missiles" },
+    { MB_DEFLECT_MSL,       "deflecting missiles" },
+    { MB_FEAR_INSPIRING,    "inspiring fear" },
+    { MB_BREATH_WEAPON,     "catching %s breath" },
+    { MB_DAZED,             "dazed" },
+    { MB_MUTE,              "mute" },
+    { MB_BLIND,             "blind" },
+    { MB_DUMB,              "stupefied" },
+    { MB_MAD,               "lost in madness" },
+    { MB_REGENERATION,      "regenerating" },
+    { MB_RAISED_MR,         "resistant to hostile enchantments" },
+    { MB_OZOCUBUS_ARMOUR,   "covered in an icy film" },
+    { MB_WRETCHED,          "misshapen and mutated" },
+    { MB_WORD_OF_RECALL,    "chanting recall" },
+    { MB_INJURY_BOND,       "sheltered from injuries" },
+    { MB_WATER_HOLD,        "engulfed in water" },
+    { MB_WATER_HOLD_DROWN,  "engulfed in water" },
+    { MB_WATER_HOLD_DROWN,  "unable to breathe" },
+    { MB_FLAYED,            "covered in terrible wounds" },
+    { MB_WEAK,              "weak" },
+    { MB_DIMENSION_ANCHOR,  "unable to translocate" },
+    { MB_TOXIC_RADIANCE,    "radiating toxic energy" },
+    { MB_GRASPING_ROOTS,    "constricted by roots" },
+    { MB_FIRE_VULN,         "more vulnerable to fire" },
+    { MB_TORNADO,           "surrounded by raging winds" },
+    { MB_TORNADO_COOLDOWN,  "surrounded by restless winds" },
+    { MB_BARBS,             "skewered by barbs" },
+    { MB_POISON_VULN,       "more vulnerable to poison" },
+    { MB_ICEMAIL,           "surrounded by an icy envelope" },
+    { MB_AGILE,             "unusually agile" },
+    { MB_FROZEN,            "encased in ice" },
+    { MB_BLACK_MARK,        "absorbing vital energies" },
+    { MB_SAP_MAGIC,         "magic-sapped" },
+    { MB_SHROUD,            "shrouded" },
+    { MB_CORROSION,         "covered in acid" },
+    { MB_SLOW_MOVEMENT,     "covering ground slowly" },
+    { MB_LIGHTLY_DRAINED,   "lightly drained" },
+    { MB_HEAVILY_DRAINED,   "heavily drained" },
+    { MB_RESISTANCE,        "unusually resistant" },
+    { MB_HEXED,             "control wrested from you" },
+    { MB_BRILLIANCE_AURA,   "aura of brilliance" },
+    { MB_EMPOWERED_SPELLS,  "spells empowered" },
+    { MB_READY_TO_HOWL,     "ready to howl" },
+    { MB_PARTIALLY_CHARGED, "partially charged" },
+    { MB_FULLY_CHARGED,     "fully charged" },
+    { MB_GOZAG_INCITED,     "incited by Gozag" },
+    { MB_PAIN_BOND,         "sharing %s pain" },
+    { MB_IDEALISED,         "idealised" },
+    { MB_BOUND_SOUL,        "bound soul" },
+    { MB_INFESTATION,       "infested" },
+    { MB_STILL_WINDS,       "stilling the winds" },
+    { MB_VILE_CLUTCH,       "constricted by zombie hands" },
+};
+
+static constexpr array<uint8_t, NUM_MB_FLAGS> _attribute_index
+    = _index_by_flag(_attribute_list);
+
+// Attributes as their English descriptions (which are also the msgids),
+// which may contain "%s" for the possessive pronoun.
+vector<const char *> monster_info::attribute_ids() const
+{
+    vector<const char *> v;
 
     if (is(MB_BERSERK))
-        v.emplace_back("berserk");
+        v.push_back("berserk");
     if (is(MB_HASTED) || is(MB_BERSERK))
+        v.push_back(is(MB_SLOWED) ? "fast+slow" : "fast");
+    else if (is(MB_SLOWED))
+        v.push_back("slow");
+    if (is(MB_STRONG) || is(MB_BERSERK))
+        v.push_back("unusually strong");
+
+    // Only visit the flags which are set, then put them in list order.
+    // A flag may have more than one entry, next to each other.
+    uint8_t found[ARRAYSZ(_attribute_list)];
+    size_t nfound = 0;
+    mb.for_each_set([&](unsigned int flag)
+    {
+        if (const unsigned int pos = _attribute_index[flag])
+        {
+            for (unsigned int i = pos - 1; i < ARRAYSZ(_attribute_list)
+                 && _attribute_list[i].flag == flag; i++)
+            {
+                found[nfound++] = i;
+            }
+        }
+    });
+    sort(found, found + nfound);
+
+    for (size_t i = 0; i < nfound; i++)
+        v.push_back(_attribute_list[found[i]].desc);
+    return v;
+}
+
+vector<string> monster_info::attributes() const
+{
+    vector<string> v;
+    for (const char *id : attribute_ids())
     {
-        if (!is(MB_SLOWED))
-            v.emplace_back("fast");
+        if (strstr(id, "%s"))
+            v.push_back(make_stringf(id, pronoun(PRONOUN_POSSESSIVE)));
         else
-            v.emplace_back("fast+slow");
+            v.emplace_back(id);
     }
-    else if (is(MB_SLOWED))
-        v.emplace_back("slow");
-    if (is(MB_STRONG) || is(MB_BERSERK))
-        v.emplace_back("unusually strong");
-
-    if (is(MB_POISONED))
-        v.emplace_back("poisoned");
-    if (is(MB_SICK))
-        v.emplace_back("sick");
-    if (is(MB_GLOWING))
-        v.emplace_back("softly glowing");
-    if (is(MB_INSANE))
-        v.emplace_back("frenzied and insane");
-    if (is(MB_CONFUSED))
-        v.emplace_back("confused");
-    if (is(MB_PINNED))
-        v.emplace_back("pinned by a whirlwind");
-    if (is(MB_INVISIBLE))
-        v.emplace_back("slightly transparent");
-    if (is(MB_CHARMED))
-        v.emplace_back("in your thrall");
-    if (is(MB_BURNING))
-        v.emplace_back("covered in liquid flames");
-    if (is(MB_CAUGHT))
-        v.emplace_back("entangled in a net");
-    if (is(MB_WEBBED))
-        v.emplace_back("entangled in a web");
-    if (is(MB_PETRIFIED))
-        v.emplace_back("petrified");
-    if (is(MB_PETRIFYING))
-        v.emplace_back("slowly petrifying");
-    if (is(MB_VULN_MAGIC))
-        v.emplace_back("susceptible to hostile enchantments");
-    if (is(MB_SWIFT))
-        v.emplace_back("covering ground quickly");
-    if (is(MB_SILENCING))
-        v.emplace_back("radiating silence");
-    if (is(MB_PARALYSED))
-        v.emplace_back("paralysed");
-    if (is(MB_REPEL_MSL))
-        v.emplace_back("repelling missiles");
-    if (is(MB_DEFLECT_MSL))
-        v.emplace_back("deflecting missiles");
-    if (is(MB_FEAR_INSPIRING))
-        v.emplace_back("inspiring fear");
-    if (is(MB_BREATH_WEAPON))
-    {
-        v.push_back(string("catching ")
-                    + pronoun(PRONOUN_POSSESSIVE) + " breath");
-    }
-    if (is(MB_DAZED))
-        v.emplace_back("dazed");
-    if (is(MB_MUTE))
-        v.emplace_back("mute");
-    if (is(MB_BLIND))
-        v.emplace_back("blind");
-    if (is(MB_DUMB))
-        v.emplace_back("stupefied");
-    if (is(MB_MAD))
-        v.emplace_back("lost in madness");
-    if (is(MB_REGENERATION))
-        v.emplace_back("regenerating");
-    if (is(MB_RAISED_MR))
-        v.emplace_back("resistant to hostile enchantments");
-    if (is(MB_OZOCUBUS_ARMOUR))
-        v.emplace_back("covered in an icy film");
-    if (is(MB_WRETCHED))
-        v.emplace_back("misshapen and mutated");
-    if (is(MB_WORD_OF_RECALL))
-        v.emplace_back("chanting recall");
-    if (is(MB_INJURY_BOND))
-        v.emplace_back("sheltered from injuries");
-    if (is(MB_WATER_HOLD))
-        v.emplace_back("engulfed in water");
-    if (is(MB_WATER_HOLD_DROWN))
-    {
-        v.emplace_back("engulfed in water");
-        v.emplace_back("unable to breathe");
-    }
-    if (is(MB_FLAYED))
-        v.emplace_back("covered in terrible wounds");
-    if (is(MB_WEAK))
-        v.emplace_back("weak");
-    if (is(MB_DIMENSION_ANCHOR))
-        v.emplace_back("unable to translocate");
-    if (is(MB_TOXIC_RADIANCE))
-        v.emplace_back("radiating toxic energy");
-    if (is(MB_GRASPING_ROOTS))
-        v.emplace_back("constricted by roots");
-    if (is(MB_FIRE_VULN))
-        v.emplace_back("more vulnerable to fire");
-    if (is(MB_TORNADO))
-        v.emplace_back("surrounded by raging winds");
-    if (is(MB_TORNADO_COOLDOWN))
-        v.emplace_back("surrounded by restless winds");
-    if (is(MB_BARBS))
-        v.emplace_back("skewered by barbs");
-    if (is(MB_POISON_VULN))
-        v.emplace_back("more vulnerable to poison");
-    if (is(MB_ICEMAIL))
-        v.emplace_back("surrounded by an icy envelope");
-    if (is(MB_AGILE))
-        v.emplace_back("unusually agile");
-    if (is(MB_FROZEN))
-        v.emplace_back("encased in ice");
-    if (is(MB_BLACK_MARK))
-        v.emplace_back("absorbing vital energies");
-    if (is(MB_SAP_MAGIC))
-        v.emplace_back("magic-sapped");
-    if (is(MB_SHROUD))
-        v.emplace_back("shrouded");
-    if (is(MB_CORROSION))
-        v.emplace_back("covered in acid");
-    if (is(MB_SLOW_MOVEMENT))
-        v.emplace_back("covering ground slowly");
-    if (is(MB_LIGHTLY_DRAINED))
-        v.emplace_back("lightly drained");
-    if (is(MB_HEAVILY_DRAINED))
-        v.emplace_back("heavily drained");
-    if (is(MB_RESISTANCE))
-        v.emplace_back("unusually resistant");
-    if (is(MB_HEXED))
-        v.emplace_back("control wrested from you");
-    if (is(MB_BRILLIANCE_AURA))
-        v.emplace_back("aura of brilliance");
-    if (is(MB_EMPOWERED_SPELLS))
-        v.emplace_back("spells empowered");
-    if (is(MB_READY_TO_HOWL))
-        v.emplace_back("ready to howl");
-    if (is(MB_PARTIALLY_CHARGED))
-        v.emplace_back("partially charged");
-    if (is(MB_FULLY_CHARGED))
-        v.emplace_back("fully charged");
-    if (is(MB_GOZAG_INCITED))
-        v.emplace_back("incited by Gozag");
-    if (is(MB_PAIN_BOND))
-    {
-        v.push_back(string("sharing ")
-                    + pronoun(PRONOUN_POSSESSIVE) + " pain");
-    }
-    if (is(MB_IDEALISED))
-        v.emplace_back("idealised");
-    if (is(MB_BOUND_SOUL))
-        v.emplace_back("bound soul");
-    if (is(MB_INFESTATION))
-        v.emplace_back("infested");
-    if (is(MB_STILL_WINDS))
-        v.emplace_back("stilling the winds");
-    if (is(MB_VILE_CLUTCH))
-        v.emplace_back("constricted by zombie hands");
     return v;
 }
 
@@ -1845,7 +1985,7 @@ bool monster_info::debuffable() const
                   { return this->has_trivial_ench(ench); });
 }
 
-void get_monster_info(vector<monster_info>& mons)
+static vector<monster*> _listed_monsters()
 {
     vector<monster* > visible;
     if (crawl_state.game_is_arena())
@@ -1856,17 +1996,55 @@ void get_monster_info(vector<monster_info>& mons)
     else
         visible = get_nearby_monsters();
 
+    vector<monster*> listed;
     for (monster *mon : visible)
     {
         if (mons_is_threatening(*mon)
             || mon->is_child_tentacle())
         {
-            mons.emplace_back(mon);
+            listed.push_back(mon);
         }
     }
+    return listed;
+}
+
+void get_monster_info(vector<monster_info>& mons)
+{
+    for (monster *mon : _listed_monsters())
+        mons.emplace_back(mon);
     sort(mons.begin(), mons.end(), monster_info::less_than_wrapper);
 }
 
+/**
+ * As above, but with the infos from pool, valid until the caller resets it.
+ * Also sorts pointers rather than copying infos around.
+ */
+void get_monster_info(vector<const monster_info*>& mons,
+                      monster_info_pool &pool)
+{
+    for (monster *mon : _listed_monsters())
+        mons.push_back(&pool.acquire(mon));
+    sort(mons.begin(), mons.end(),
+         [](const monster_info *m1, const monster_info *m2)
+         {
+             return monster_info::less_than_wrapper(*m1, *m2);
+         });
+}
+
+/**
+ * Bring mons up to date with the monsters now listed, adding the edits
+ * to deltas. Cheaper than get_monster_info() when little has changed,
+ * since nothing is re-sorted, and the deltas are all a client needs.
+ */
+void update_monster_list(monster_list &mons,
+                         vector<monster_list_delta> &deltas)
+{
+    vector<monster_info> infos;
+    for (monster *mon : _listed_monsters())
+        infos.emplace_back(mon);
+    mons.update(infos, deltas);
+}
+
 monster_type monster_info::draco_or_demonspawn_subspecies() const
 {
     if (type == MONS_PLAYER_ILLUSION && mons_genus(type) == MONS_DRACONIAN)
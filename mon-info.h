@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <functional>
 
 #include "enchant-type.h"
@@ -242,6 +243,8 @@ struct monster_info : public monster_info_base
 #define MILEV_SKIP_SAFE -1
 #define MILEV_NAME -2
     monster_info() { client_id = 0; }
+    // MILEV_NAME gives just enough for names and pronouns, which is all
+    // monster::name() needs, and skips copying most props.
     explicit monster_info(const monster* m, int level = MILEV_ALL);
     explicit monster_info(monster_type p_type,
                           monster_type p_base_type = MONS_NO_MONSTER);
@@ -266,6 +269,11 @@ struct monster_info : public monster_info_base
         return *this;
     }
 
+    monster_info(monster_info&& mi) = default;
+    monster_info& operator=(monster_info&& mi) = default;
+
+    void init(const monster* m, int level = MILEV_ALL);
+
     void to_string(int count, string& desc, int& desc_colour,
                    bool fullname = true, const char *adjective = nullptr) const;
 
@@ -309,6 +317,7 @@ struct monster_info : public monster_info_base
     string proper_name(description_level_type desc = DESC_PLAIN) const;
     string full_name(description_level_type desc = DESC_PLAIN) const;
 
+    vector<const char *> attribute_ids() const;
     vector<string> attributes() const;
 
     const char *pronoun(pronoun_type variant) const;
@@ -384,6 +393,7 @@ struct monster_info : public monster_info_base
     bool debuffable() const;
 
 protected:
+    void _clear();
     string _core_name() const;
     string _base_name() const;
     string _apply_adjusted_description(description_level_type desc, const string& s) const;
@@ -393,6 +403,107 @@ protected:
 bool set_monster_list_colour(string key, int colour);
 void clear_monster_list_colours();
 
+// What differs between two infos of the same monster, as far as the
+// monster list is concerned.
+enum monster_info_change
+{
+    MIC_NONE     = 0,
+    MIC_POS      = 1 << 0,
+    MIC_FLAGS    = 1 << 1, // status flags (mb)
+    MIC_ATTITUDE = 1 << 2,
+    MIC_THREAT   = 1 << 3,
+    MIC_DAMAGE   = 1 << 4,
+    MIC_NAME     = 1 << 5, // what the name is made of: type, mname, heads...
+    MIC_COLOUR   = 1 << 6,
+};
+
+unsigned monster_info_changes(const monster_info &old_mi,
+                              const monster_info &new_mi);
+
+enum monster_list_delta_type
+{
+    MLD_INSERT,
+    MLD_REMOVE,
+    MLD_UPDATE,
+};
+
+// One edit to the monster list. Applied in order to the previous list,
+// they give the new one.
+struct monster_list_delta
+{
+    monster_list_delta_type type;
+    uint32_t id;        // client_id of the monster
+    int index;          // where it is now (where it was, for MLD_REMOVE)
+    int old_index;      // MLD_UPDATE: where it was; it may have moved
+    unsigned changes;   // MLD_UPDATE: monster_info_change bits
+};
+
+/**
+ * The sorted monster list, kept up to date from turn to turn.
+ *
+ * update() matches this turn's infos to last turn's by client_id, which
+ * must be unique. Only monsters which came into view, left it or changed
+ * are touched, and only those whose sort position changed are moved, so
+ * equal monsters (the pane's groups) stay together. The edits come back
+ * as deltas, for the UI and clients to apply instead of taking the whole
+ * list again.
+ */
+class monster_list
+{
+public:
+    typedef bool (*order)(const monster_info&, const monster_info&);
+
+    monster_list(order less = monster_info::less_than_wrapper)
+        : less_than(less)
+    {
+    }
+
+    // Take infos (in any order, and left empty) as the new list, adding
+    // what changed to deltas.
+    void update(vector<monster_info> &infos,
+                vector<monster_list_delta> &deltas);
+
+    const vector<monster_info> &infos() const { return list; }
+    void clear() { list.clear(); }
+
+private:
+    int _index_of(uint32_t id) const;
+    int _insert(monster_info &&mi);
+
+    order less_than;
+    vector<monster_info> list;
+};
+
+/**
+ * Monster infos for one turn's worth of lists and names.
+ *
+ * Building the monster list makes an info for every monster in view, every
+ * time, only to throw them away. Infos from the pool live until its owner
+ * calls reset() (e.g. at the end of the turn, or before building the next
+ * list), after which the pool reuses them in O(1): init()
+ * keeps their strings' and vectors' storage, so once the pool has grown to
+ * the usual number of monsters in view it allocates nothing more.
+ */
+class monster_info_pool
+{
+public:
+    monster_info &acquire(const monster *m, int level = MILEV_ALL);
+
+    // Every info acquired so far becomes invalid.
+    void reset() { used = 0; }
+
+    size_t size() const { return used; }
+
+private:
+    // a deque, so that growing it doesn't move the infos already given out
+    deque<monster_info> infos;
+    size_t used = 0;
+};
+
 void get_monster_info(vector<monster_info>& mons);
+void get_monster_info(vector<const monster_info*>& mons,
+                      monster_info_pool &pool);
+void update_monster_list(monster_list &mons,
+                         vector<monster_list_delta> &deltas);
 
 typedef function<vector<string> (const monster_info& mi)> (desc_filter);
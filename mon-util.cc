@@ -63,6 +63,7 @@
 #include "options.h"
 #include "random.h"
 #endif
+#include "random-alias.h"
 #include "reach-type.h"
 #if NOT_XLATE_POC
 #include "religion.h"
@@ -99,10 +100,13 @@ struct mon_display
 };
 
 static mon_display monster_symbols[NUM_MONSTERS];
+static mon_name_forms monster_names[NUM_MONSTERS];
+static mon_class_traits monster_traits[NUM_MONSTERS];
+static mon_class_stats monster_stats[NUM_MONSTERS];
 
 static bool initialised_randmons = false;
-static vector<monster_type> monsters_by_habitat[NUM_HABITATS];
-static vector<monster_type> species_by_habitat[NUM_HABITATS];
+static alias_table<monster_type> monsters_by_habitat[NUM_HABITATS];
+static alias_table<monster_type> species_by_habitat[NUM_HABITATS];
 
 #if NOT_XLATE_POC
 #include "mon-spell.h"
@@ -111,7 +115,7 @@ static vector<monster_type> species_by_habitat[NUM_HABITATS];
 
 #define MONDATASIZE ARRAYSZ(mondata)
 
-static int _mons_exp_mod(monster_type mclass);
+static void _init_monster_attacks();
 
 // Macro that saves some typing, nothing more.
 #define smc get_monster_data(mc)
@@ -161,6 +165,7 @@ static void _initialise_randmons()
 {
     for (int i = 0; i < NUM_HABITATS; ++i)
     {
+        vector<pair<monster_type, int>> monsters;
         set<monster_type> tmp_species;
         const dungeon_feature_type grid = habitat2grid(habitat_type(i));
 
@@ -170,7 +175,7 @@ static void _initialise_randmons()
                 continue;
 
             if (monster_habitable_grid(mt, grid))
-                monsters_by_habitat[i].push_back(mt);
+                monsters.emplace_back(mt, 1);
 
             const monster_type species = mons_species(mt);
             if (monster_habitable_grid(species, grid))
@@ -178,24 +183,45 @@ static void _initialise_randmons()
 
         }
 
+        vector<pair<monster_type, int>> species;
         for (auto type : tmp_species)
-            species_by_habitat[i].push_back(type);
+            species.emplace_back(type, 1);
+
+        monsters_by_habitat[i].build(monsters);
+        species_by_habitat[i].build(species);
     }
     initialised_randmons = true;
 }
 
-monster_type random_monster_at_grid(const coord_def& p, bool species)
+static const alias_table<monster_type> &_randmons_at_grid(const coord_def& p,
+                                                          bool species)
 {
     if (!initialised_randmons)
         _initialise_randmons();
 
     const habitat_type ht = _grid2habitat(grd(p));
-    const vector<monster_type> &valid_mons = species ? species_by_habitat[ht]
-                                                     : monsters_by_habitat[ht];
+    const alias_table<monster_type> &valid_mons =
+        species ? species_by_habitat[ht] : monsters_by_habitat[ht];
 
     ASSERT(!valid_mons.empty());
+    return valid_mons;
+}
+
+monster_type random_monster_at_grid(const coord_def& p, bool species)
+{
+    const alias_table<monster_type> &valid_mons = _randmons_at_grid(p, species);
     return valid_mons.empty() ? MONS_PROGRAM_BUG
-                              : valid_mons[ random2(valid_mons.size()) ];
+                              : valid_mons.pick(rng::get_uint32());
+}
+
+void random_monsters_at_grid(const coord_def& p, monster_type *mons,
+                             size_t count, bool species)
+{
+    const alias_table<monster_type> &valid_mons = _randmons_at_grid(p, species);
+    if (valid_mons.empty())
+        fill(mons, mons + count, MONS_PROGRAM_BUG);
+    else
+        valid_mons.pick_many(mons, count, [] { return rng::get_uint32(); });
 }
 
 typedef map<string, monster_type> mon_name_map;
@@ -263,6 +289,147 @@ monster_type get_monster_by_name(string name, bool substring)
 
 static bool monsters_initialized = false; // XLATE_POC
 
+static bool _class_is_zombified(monster_type mc)
+{
+#if TAG_MAJOR_VERSION == 34
+    switch (mc)
+    {
+        case MONS_ZOMBIE_SMALL:     case MONS_ZOMBIE_LARGE:
+        case MONS_SKELETON_SMALL:   case MONS_SKELETON_LARGE:
+        case MONS_SIMULACRUM_SMALL: case MONS_SIMULACRUM_LARGE:
+            return true;
+        default:
+            break;
+    }
+#endif
+
+    return mc == MONS_ZOMBIE
+        || mc == MONS_SKELETON
+        || mc == MONS_SIMULACRUM
+        || mc == MONS_SPECTRAL_THING;
+}
+
+// Work out the traits the slow way. Careful: nothing here may use the
+// predicates which read the table.
+static mon_class_traits _derive_traits(monster_type mc)
+{
+    const monsterentry *me = get_monster_data(mc);
+    mon_class_traits traits;
+    traits.genus = me->genus;
+    traits.species = me->species;
+    traits.holiness = me->holiness;
+    traits.size = me->size;
+
+    const monster_type genus = me->genus;
+    const bool traits_of[NUM_MON_CLASS_TRAITS] =
+    {
+        // MCT_DEMON
+        me->holiness & MH_DEMONIC
+            && ((mons_demon_tier(mc) != 0 && mc != MONS_ANTAEUS)
+                || me->species == MONS_RAKSHASA),
+        mons_is_draconian(mc),
+        mons_is_base_draconian(mc),
+        mons_is_draconian_job(mc),
+        mons_is_demonspawn(mc),
+        mons_is_demonspawn_job(mc),
+        _class_is_zombified(mc),
+        // MCT_SLIME
+        genus == MONS_JELLY
+            || genus == MONS_FLOATING_EYE
+            || genus == MONS_GLOWING_ORANGE_BRAIN,
+        bool(me->holiness & MH_PLANT),
+        bool(me->bitfields & (M_COLD_BLOOD | M_WARM_BLOOD)),
+        // MCT_SENSED
+        mc == MONS_SENSED
+            || mc == MONS_SENSED_FRIENDLY
+            || mc == MONS_SENSED_TRIVIAL
+            || mc == MONS_SENSED_EASY
+            || mc == MONS_SENSED_TOUGH
+            || mc == MONS_SENSED_NASTY,
+        bool(me->bitfields & M_STATIONARY),
+        bool(me->bitfields & M_UNIQUE),
+        mons_is_pghost(mc),
+        bool(me->bitfields & M_ANCESTOR),
+        // MCT_STATUE
+        mc == MONS_ORANGE_STATUE
+            || mc == MONS_OBSIDIAN_STATUE
+            || mc == MONS_ICE_STATUE
+            || mc == MONS_ROXANNE,
+        bool(me->bitfields & M_HYBRID),
+        mons_class_is_animated_weapon(mc),
+        genus == MONS_HYDRA,
+        // MCT_CONJURED
+#if NOT_XLATE_POC
+        mons_is_projectile(mc)
+            || mons_is_avatar(mc)
+            || bool(me->bitfields & M_CONJURED),
+#else
+        bool(me->bitfields & M_CONJURED),
+#endif
+    };
+
+    traits.mask = 0;
+    for (int i = 0; i < NUM_MON_CLASS_TRAITS; i++)
+        if (traits_of[i])
+            traits.mask |= mct_bit((mon_class_trait)i);
+    return traits;
+}
+
+// Demonspawn with a job, which are the basic demonspawn plus the job.
+static bool _is_nonbase_demonspawn(monster_type mc)
+{
+    return mons_is_demonspawn(mc)
+           && mc != MONS_DEMONSPAWN
+           && mons_species(mc) == MONS_DEMONSPAWN;
+}
+
+static mon_class_stats _derive_stats(monster_type mc)
+{
+    const monsterentry *me = get_monster_data(mc);
+    mon_class_stats stats;
+
+    // Hack for nonbase demonspawn: pretend it's a basic demonspawn with
+    // a job.
+    int hp_10x = me->avg_hp_10x;
+    if (_is_nonbase_demonspawn(mc))
+        hp_10x += get_monster_data(MONS_DEMONSPAWN)->avg_hp_10x;
+    stats.avg_hp = hp_10x / 10;
+    // TODO: merge the 133% with their use in hit_points()
+    stats.max_hp = hp_10x * 133 / 1000;
+
+    stats.melee_damage = 0;
+    for (const mon_attack_def &attack : me->attack)
+        stats.melee_damage += attack.damage;
+    stats.exp_mod = me->exp_mod;
+    stats.gives_xp = !(me->bitfields & M_NO_EXP_GAIN);
+    stats.fast_regen = bool(me->bitfields & M_FAST_REGEN);
+    return stats;
+}
+
+// (Types without data of their own use the program bug's, as before.)
+static void _init_monster_traits()
+{
+    for (monster_type mc = MONS_0; mc < NUM_MONSTERS; ++mc)
+    {
+        monster_traits[mc] = _derive_traits(mc);
+        monster_stats[mc] = _derive_stats(mc);
+    }
+}
+
+// Save running the English morphology rules every time a name is rendered.
+static void _init_monster_names()
+{
+    for (monster_type mc = MONS_0; mc < NUM_MONSTERS; ++mc)
+    {
+        mon_name_forms &names = monster_names[mc];
+        names.plain = mons_type_name(mc, DESC_PLAIN);
+        names.the = mons_type_name(mc, DESC_THE);
+        names.a = mons_type_name(mc, DESC_A);
+        names.plural = pluralise_monster(names.plain);
+        names.possessive = apostrophise(names.plain);
+    }
+}
+
 void init_monsters()
 {
     // XLATE_POC
@@ -285,6 +452,11 @@ void init_monsters()
         if (entry == -1)
             entry = mon_entry[MONS_PROGRAM_BUG];
 
+    // before the names, which use the traits
+    _init_monster_traits();
+    _init_monster_attacks();
+    _init_monster_names();
+
 #if NOT_XLATE_POC
     init_monster_symbols();
 #endif
@@ -717,7 +889,7 @@ mon_holy_type mons_class_holiness(monster_type mc)
 
 bool mons_class_is_stationary(monster_type mc)
 {
-    return mons_class_flag(mc, M_STATIONARY);
+    return mons_class_has_trait(mc, mct_bit(MCT_STATIONARY));
 }
 
 #if NOT_XLATE_POC
@@ -929,18 +1101,12 @@ bool mons_is_object(monster_type mc)
 
 bool mons_has_blood(monster_type mc)
 {
-    return mons_class_flag(mc, M_COLD_BLOOD)
-           || mons_class_flag(mc, M_WARM_BLOOD);
+    return mons_class_has_trait(mc, mct_bit(MCT_BLOOD));
 }
 
 bool mons_is_sensed(monster_type mc)
 {
-    return mc == MONS_SENSED
-           || mc == MONS_SENSED_FRIENDLY
-           || mc == MONS_SENSED_TRIVIAL
-           || mc == MONS_SENSED_EASY
-           || mc == MONS_SENSED_TOUGH
-           || mc == MONS_SENSED_NASTY;
+    return mons_class_has_trait(mc, mct_bit(MCT_SENSED));
 }
 
 #if NOT_XLATE_POC
@@ -1046,9 +1212,7 @@ bool mons_is_abyssal_only(monster_type mc)
 // Monsters considered as "slime" for Jiyva.
 bool mons_class_is_slime(monster_type mc)
 {
-    return mons_genus(mc) == MONS_JELLY
-           || mons_genus(mc) == MONS_FLOATING_EYE
-           || mons_genus(mc) == MONS_GLOWING_ORANGE_BRAIN;
+    return mons_class_has_trait(mc, mct_bit(MCT_SLIME));
 }
 
 bool mons_is_slime(const monster& mon)
@@ -1065,7 +1229,7 @@ bool herd_monster(const monster& mon)
 // permanent plant holiness
 bool mons_class_is_plant(monster_type mc)
 {
-    return bool(mons_class_holiness(mc) & MH_PLANT);
+    return mons_class_has_trait(mc, mct_bit(MCT_PLANT));
 }
 
 bool mons_is_plant(const monster& mon)
@@ -1121,10 +1285,7 @@ bool invalid_monster_index(int i)
 
 bool mons_is_statue(monster_type mc)
 {
-    return mc == MONS_ORANGE_STATUE
-           || mc == MONS_OBSIDIAN_STATUE
-           || mc == MONS_ICE_STATUE
-           || mc == MONS_ROXANNE;
+    return mons_class_has_trait(mc, mct_bit(MCT_STATUE));
 }
 
 #if NOT_XLATE_POC
@@ -1226,9 +1387,7 @@ void discover_shifter(monster& shifter)
 
 bool mons_is_demon(monster_type mc)
 {
-    return mons_class_holiness(mc) & MH_DEMONIC
-             && (mons_demon_tier(mc) != 0 && mc != MONS_ANTAEUS
-                 || mons_species(mc) == MONS_RAKSHASA);
+    return mons_class_has_trait(mc, mct_bit(MCT_DEMON));
 }
 
 int mons_demon_tier(monster_type mc)
@@ -1283,9 +1442,7 @@ bool mons_is_demonspawn(monster_type mc)
 // things rather than beings.
 bool mons_is_conjured(monster_type mc)
 {
-    return mons_is_projectile(mc)
-           || mons_is_avatar(mc)
-           || mons_class_flag(mc, M_CONJURED);
+    return mons_class_has_trait(mc, mct_bit(MCT_CONJURED));
 }
 #endif
 
@@ -1580,7 +1737,7 @@ bool mons_is_job(monster_type mc)
 
 bool mons_is_unique(monster_type mc)
 {
-    return mons_class_flag(mc, M_UNIQUE);
+    return mons_class_has_trait(mc, mct_bit(MCT_UNIQUE));
 }
 
 #if NOT_XLATE_POC
@@ -1600,7 +1757,7 @@ bool mons_is_or_was_unique(const monster& mon)
  */
 bool mons_is_hepliaklqana_ancestor(monster_type mc)
 {
-    return mons_class_flag(mc, M_ANCESTOR);
+    return mons_class_has_trait(mc, mct_bit(MCT_ANCESTOR));
 }
 
 /**
@@ -1742,27 +1899,12 @@ monster_type mons_zombie_base(const monster& mon)
 
 bool mons_class_is_zombified(monster_type mc)
 {
-#if TAG_MAJOR_VERSION == 34
-    switch (mc)
-    {
-        case MONS_ZOMBIE_SMALL:     case MONS_ZOMBIE_LARGE:
-        case MONS_SKELETON_SMALL:   case MONS_SKELETON_LARGE:
-        case MONS_SIMULACRUM_SMALL: case MONS_SIMULACRUM_LARGE:
-            return true;
-        default:
-            break;
-    }
-#endif
-
-    return mc == MONS_ZOMBIE
-        || mc == MONS_SKELETON
-        || mc == MONS_SIMULACRUM
-        || mc == MONS_SPECTRAL_THING;
+    return mons_class_has_trait(mc, mct_bit(MCT_ZOMBIFIED));
 }
 
 bool mons_class_is_hybrid(monster_type mc)
 {
-    return mons_class_flag(mc, M_HYBRID);
+    return mons_class_has_trait(mc, mct_bit(MCT_HYBRID));
 }
 
 bool mons_class_is_animated_weapon(monster_type type)
@@ -1908,10 +2050,10 @@ static int _downscale_zombie_damage(int damage)
     return max(1, 4 * damage / 5);
 }
 
-#if NOT_XLATE_POC
-static mon_attack_def _downscale_zombie_attack(const monster& mons,
-                                               mon_attack_def attk,
-                                               bool random)
+// Spectral things drain, sometimes at random, so that's left to
+// mons_attack_spec().
+static mon_attack_def _downscale_zombie_attack(mon_attack_def attk,
+                                               bool simulacrum)
 {
     switch (attk.type)
     {
@@ -1923,10 +2065,8 @@ static mon_attack_def _downscale_zombie_attack(const monster& mons,
         break;
     }
 
-    if (mons.type == MONS_SIMULACRUM)
+    if (simulacrum)
         attk.flavour = AF_COLD;
-    else if (mons.type == MONS_SPECTRAL_THING && (!random || coinflip()))
-        attk.flavour = AF_DRAIN_XP;
     else if (attk.flavour != AF_REACH && attk.flavour != AF_CRUSH)
         attk.flavour = AF_PLAIN;
 
@@ -1935,6 +2075,80 @@ static mon_attack_def _downscale_zombie_attack(const monster& mons,
     return attk;
 }
 
+// An attack in a third of the space of a mon_attack_def: a class's three
+// tables fit in a cache line.
+struct packed_attack
+{
+    uint8_t type;
+    uint8_t flavour;
+    uint16_t damage;
+};
+COMPILE_CHECK(NUM_ATTACK_TYPES <= 256);
+
+static packed_attack monster_attacks[NUM_MONSTERS][NUM_MON_ATTACK_VARIANTS]
+                                    [MAX_NUM_ATTACKS];
+
+static packed_attack _pack_attack(const mon_attack_def &attk)
+{
+    return { (uint8_t)attk.type, (uint8_t)attk.flavour,
+             (uint16_t)attk.damage };
+}
+
+static mon_attack_def _unpack_attack(const packed_attack &attk)
+{
+    return { (attack_type)attk.type, (attack_flavour)attk.flavour,
+             attk.damage };
+}
+
+static void _init_monster_attacks()
+{
+    for (monster_type mc = MONS_0; mc < NUM_MONSTERS; ++mc)
+    {
+        const monsterentry *me = get_monster_data(mc);
+        for (int i = 0; i < MAX_NUM_ATTACKS; ++i)
+        {
+            const mon_attack_def &attk = me->attack[i];
+            monster_attacks[mc][MAV_NORMAL][i] = _pack_attack(attk);
+            monster_attacks[mc][MAV_DERIVED][i] =
+                _pack_attack(_downscale_zombie_attack(attk, false));
+            monster_attacks[mc][MAV_SIMULACRUM][i] =
+                _pack_attack(_downscale_zombie_attack(attk, true));
+        }
+    }
+}
+
+mon_attack_def mons_class_attack(monster_type mc, int attk_number,
+                                 mon_attack_variant variant)
+{
+    init_monsters();
+    if (mc < 0 || mc >= NUM_MONSTERS
+        || attk_number < 0 || attk_number >= MAX_NUM_ATTACKS)
+    {
+        return { AT_NONE, AF_PLAIN, 0 };
+    }
+    return _unpack_attack(monster_attacks[mc][variant][attk_number]);
+}
+
+void mons_class_attacks(const monster_type *types, size_t count,
+                        int attk_number, mon_attack_variant variant,
+                        mon_attack_def *attacks)
+{
+    init_monsters();
+    if (attk_number < 0 || attk_number >= MAX_NUM_ATTACKS)
+    {
+        fill(attacks, attacks + count, mon_attack_def{ AT_NONE, AF_PLAIN, 0 });
+        return;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        attacks[i] = types[i] >= 0 && types[i] < NUM_MONSTERS
+            ? _unpack_attack(monster_attacks[types[i]][variant][attk_number])
+            : mon_attack_def{ AT_NONE, AF_PLAIN, 0 };
+    }
+}
+
+#if NOT_XLATE_POC
+
 /**
  * What attack does the given mutant beast facet provide?
  *
@@ -2057,11 +2271,16 @@ mon_attack_def mons_attack_spec(const monster& m, int attk_number,
     else if (mons_is_demonspawn(mc) && attk_number != 0)
         mc = draco_or_demonspawn_subspecies(mon);
 
-    if (zombified && mc != MONS_KRAKEN_TENTACLE)
-        mc = mons_zombie_base(mon);
+    mon_attack_variant variant = MAV_NORMAL;
+    if (zombified)
+    {
+        if (mc != MONS_KRAKEN_TENTACLE)
+            mc = mons_zombie_base(mon);
+        variant = mon.type == MONS_SIMULACRUM ? MAV_SIMULACRUM : MAV_DERIVED;
+    }
 
     ASSERT_smc();
-    mon_attack_def attk = smc->attack[attk_number];
+    mon_attack_def attk = mons_class_attack(mc, attk_number, variant);
 
     if (mons_is_demonspawn(mon.type) && attk_number == 0)
     {
@@ -2080,7 +2299,7 @@ mon_attack_def mons_attack_spec(const monster& m, int attk_number,
         && mon.type != MONS_DRACONIAN
         && attk.type == AT_NONE
         && attk_number > 0
-        && smc->attack[attk_number - 1].type != AT_NONE)
+        && mons_class_attack(mc, attk_number - 1).type != AT_NONE)
     {
         const monsterentry* mbase =
             get_monster_data (draco_or_demonspawn_subspecies(mon));
@@ -2107,15 +2326,10 @@ mon_attack_def mons_attack_spec(const monster& m, int attk_number,
     if (mon.type == MONS_SLIME_CREATURE && mon.blob_size > 1)
         attk.damage *= mon.blob_size;
 
-    return zombified ? _downscale_zombie_attack(mon, attk, !base_flavour) : attk;
-}
+    if (mon.type == MONS_SPECTRAL_THING && (base_flavour || coinflip()))
+        attk.flavour = AF_DRAIN_XP;
 
-static int _mons_damage(monster_type mc, int rt)
-{
-    if (rt < 0 || rt > 3)
-        rt = 0;
-    ASSERT_smc();
-    return smc->attack[rt].damage;
+    return attk;
 }
 #endif
 
@@ -2347,7 +2561,6 @@ bool mons_class_sees_invis(monster_type type, monster_type base)
     return false;
 }
 
-#if NOT_XLATE_POC
 /**
  * What's the average hp for a given type of monster?
  *
@@ -2356,22 +2569,7 @@ bool mons_class_sees_invis(monster_type type, monster_type base)
  */
 int mons_avg_hp(monster_type mc)
 {
-    const monsterentry* me = get_monster_data(mc);
-
-    if (!me)
-        return 0;
-
-    // Hack for nonbase demonspawn: pretend it's a basic demonspawn with
-    // a job.
-    if (mons_is_demonspawn(mc)
-        && mc != MONS_DEMONSPAWN
-        && mons_species(mc) == MONS_DEMONSPAWN)
-    {
-        const monsterentry* mbase = get_monster_data(MONS_DEMONSPAWN);
-        return (mbase->avg_hp_10x + me->avg_hp_10x) / 10;
-    }
-
-    return me->avg_hp_10x / 10;
+    return mons_class_stats(mc).avg_hp;
 }
 
 /**
@@ -2384,28 +2582,16 @@ int mons_avg_hp(monster_type mc)
  */
 int mons_max_hp(monster_type mc, monster_type mbase_type)
 {
-    const monsterentry* me = get_monster_data(mc);
-
-    if (!me)
-        return 0;
-
-    // TODO: merge the 133% with their use in hit_points()
-
-    // Hack for nonbase demonspawn: pretend it's a basic demonspawn with
-    // a job.
-    if (mons_is_demonspawn(mc)
-        && mc != MONS_DEMONSPAWN
-        && mons_species(mc) == MONS_DEMONSPAWN)
-    {
-        const monsterentry* mbase =
-            get_monster_data(mbase_type != MONS_NO_MONSTER ? mbase_type
-                                                           : MONS_DEMONSPAWN);
-        return (mbase->avg_hp_10x + me->avg_hp_10x) * 133 / 1000;
-    }
+    // Only a demonspawn's job cares which demonspawn it is.
+    if (mbase_type == MONS_NO_MONSTER || !_is_nonbase_demonspawn(mc))
+        return mons_class_stats(mc).max_hp;
 
-    return me->avg_hp_10x * 133 / 1000;
+    const monsterentry* me = get_monster_data(mc);
+    const monsterentry* mbase = get_monster_data(mbase_type);
+    return (mbase->avg_hp_10x + me->avg_hp_10x) * 133 / 1000;
 }
 
+#if NOT_XLATE_POC
 int exper_value(const monster& mon, bool real)
 {
     int x_val = 0;
@@ -2415,6 +2601,12 @@ int exper_value(const monster& mon, bool real)
     int hd                = mon.get_experience_level();
     int maxhp             = mon.max_hit_points;
 
+    const mon_class_stats &stats = mons_class_stats(mc);
+
+    // Early out for no XP monsters.
+    if (!stats.gives_xp)
+        return 0;
+
     // pghosts and pillusions have no reasonable base values, and you can look
     // up the exact value anyway. Especially for pillusions.
     if (real || mon.type == MONS_PLAYER_GHOST || mon.type == MONS_PLAYER_ILLUSION)
@@ -2436,7 +2628,7 @@ int exper_value(const monster& mon, bool real)
         // general.
         if (m->mc == MONS_PANDEMONIUM_LORD)
             hd = m->HD;
-        maxhp = mons_max_hp(mc);
+        maxhp = stats.max_hp;
     }
 
     // Hacks to make merged slime creatures not worth so much exp. We
@@ -2447,16 +2639,12 @@ int exper_value(const monster& mon, bool real)
 
     // These are some values we care about.
     const int speed       = mons_base_speed(mon);
-    const int modifier    = _mons_exp_mod(mc);
+    const int modifier    = stats.exp_mod;
     const int item_usage  = mons_itemuse(mon);
 
     // XXX: Shapeshifters can qualify here, even though they can't cast.
     const bool spellcaster = mon.has_spells();
 
-    // Early out for no XP monsters.
-    if (!mons_class_gives_xp(mc))
-        return 0;
-
     x_val = (16 + maxhp) * hd * hd / 10;
 
     // Let's calculate a simple difficulty modifier. - bwr
@@ -2523,15 +2711,13 @@ int exper_value(const monster& mon, bool real)
     }
 
     // Let's look at regeneration.
-    if (mons_class_fast_regen(mc))
+    if (stats.fast_regen)
         diff += 15;
 
     // Monsters at normal or fast speed with big melee damage.
     if (speed >= 10)
     {
-        int max_melee = 0;
-        for (int i = 0; i < 4; ++i)
-            max_melee += _mons_damage(mc, i);
+        const int max_melee = stats.melee_damage;
 
         if (max_melee > 30)
             diff += (max_melee / ((speed == 10) ? 2 : 1));
@@ -2602,41 +2788,44 @@ int exper_value(const monster& mon, bool real)
     return x_val;
 }
 
-static monster_type _random_mons_between(monster_type min, monster_type max)
+static alias_table<monster_type> _mons_between(monster_type min,
+                                               monster_type max)
 {
-    monster_type mc = MONS_PROGRAM_BUG;
-
-    do // skip removed monsters
-    {
-        mc = static_cast<monster_type>(random_range(min, max));
-    }
-    while (mons_is_removed(mc));
-
-    return mc;
+    vector<pair<monster_type, int>> mons;
+    for (monster_type mc = min; mc <= max; ++mc)
+        if (!mons_is_removed(mc)) // skip removed monsters
+            mons.emplace_back(mc, 1);
+    return alias_table<monster_type>(mons);
 }
 
 monster_type random_draconian_monster_species()
 {
-    return _random_mons_between(MONS_FIRST_BASE_DRACONIAN,
-                                MONS_LAST_SPAWNED_DRACONIAN);
+    static const alias_table<monster_type> mons =
+        _mons_between(MONS_FIRST_BASE_DRACONIAN, MONS_LAST_SPAWNED_DRACONIAN);
+    return mons.pick(rng::get_uint32());
 }
 
 monster_type random_draconian_job()
 {
-    return _random_mons_between(MONS_FIRST_NONBASE_DRACONIAN,
-                                MONS_LAST_NONBASE_DRACONIAN);
+    static const alias_table<monster_type> mons =
+        _mons_between(MONS_FIRST_NONBASE_DRACONIAN,
+                      MONS_LAST_NONBASE_DRACONIAN);
+    return mons.pick(rng::get_uint32());
 }
 
 monster_type random_demonspawn_monster_species()
 {
-    return _random_mons_between(MONS_FIRST_BASE_DEMONSPAWN,
-                                MONS_LAST_BASE_DEMONSPAWN);
+    static const alias_table<monster_type> mons =
+        _mons_between(MONS_FIRST_BASE_DEMONSPAWN, MONS_LAST_BASE_DEMONSPAWN);
+    return mons.pick(rng::get_uint32());
 }
 
 monster_type random_demonspawn_job()
 {
-    return _random_mons_between(MONS_FIRST_NONBASE_DEMONSPAWN,
-                                MONS_LAST_NONBASE_DEMONSPAWN);
+    static const alias_table<monster_type> mons =
+        _mons_between(MONS_FIRST_NONBASE_DEMONSPAWN,
+                      MONS_LAST_NONBASE_DEMONSPAWN);
+    return mons.pick(rng::get_uint32());
 }
 
 // Note: For consistent behavior in player_will_anger_monster(), all
@@ -3294,6 +3483,13 @@ string mons_type_name(monster_type mc, description_level_type desc)
     return result;
 }
 
+const mon_name_forms &mons_name_forms(monster_type mc)
+{
+    init_monsters();
+    ASSERT_RANGE(mc, 0, NUM_MONSTERS);
+    return monster_names[mc];
+}
+
 #if NOT_XLATE_POC
 static string _get_proper_monster_name(const monster& mon)
 {
@@ -3338,6 +3534,57 @@ bool give_monster_proper_name(monster& mon, bool orcs_only)
 }
 #endif
 
+const mon_class_traits &mons_class_traits(monster_type mc)
+{
+    static const mon_class_traits none = {};
+    init_monsters();
+    if (mc >= 0 && mc < NUM_MONSTERS)
+        return monster_traits[mc];
+    return none;
+}
+
+bool mons_class_has_trait(monster_type mc, mon_class_trait_mask mask)
+{
+    return mons_class_traits(mc).mask & mask;
+}
+
+vector<monster_type> mons_classes_with_traits(mon_class_trait_mask all,
+                                              mon_class_trait_mask none)
+{
+    init_monsters();
+    vector<monster_type> types;
+    for (monster_type mc = MONS_0; mc < NUM_MONSTERS; ++mc)
+    {
+        const mon_class_trait_mask mask = monster_traits[mc].mask;
+        if ((mask & all) == all && !(mask & none)
+            && !invalid_monster_type(mc))
+        {
+            types.push_back(mc);
+        }
+    }
+    return types;
+}
+
+void mons_class_trait_masks(const monster_type *types, size_t count,
+                            mon_class_trait_mask *masks)
+{
+    init_monsters();
+    for (size_t i = 0; i < count; i++)
+    {
+        masks[i] = types[i] >= 0 && types[i] < NUM_MONSTERS
+                   ? monster_traits[types[i]].mask : 0;
+    }
+}
+
+const mon_class_stats &mons_class_stats(monster_type mc)
+{
+    static const mon_class_stats none = {};
+    init_monsters();
+    if (mc >= 0 && mc < NUM_MONSTERS)
+        return monster_stats[mc];
+    return none;
+}
+
 // See mons_init for initialization of mon_entry array.
 monsterentry *get_monster_data(monster_type mc)
 {
@@ -3348,12 +3595,6 @@ monsterentry *get_monster_data(monster_type mc)
         return nullptr;
 }
 
-static int _mons_exp_mod(monster_type mc)
-{
-    ASSERT_smc();
-    return smc->exp_mod;
-}
-
 int mons_class_base_speed(monster_type mc)
 {
     ASSERT_smc();
@@ -214,6 +214,93 @@ monster *monster_at(const coord_def &pos);
 // this is the old moname()
 string mons_type_name(monster_type type, description_level_type desc);
 
+// English forms of a monster type's name, worked out once by init_monsters()
+struct mon_name_forms
+{
+    string plain;       // frilled lizard
+    string the;         // the frilled lizard (uniques: just the name)
+    string a;           // a frilled lizard (ditto)
+    string plural;      // frilled lizards
+    string possessive;  // frilled lizard's
+};
+const mon_name_forms &mons_name_forms(monster_type mc);
+
+// Class properties, worked out once per monster type by init_monsters() so
+// that asking is a load and a mask test rather than genus comparisons and
+// switches. mons_is_demon(), mons_class_is_zombified() etc. read these;
+// the ones which are just a range check stay that way, but are here too
+// for the batch queries.
+enum mon_class_trait
+{
+    MCT_DEMON,
+    MCT_DRACONIAN,
+    MCT_BASE_DRACONIAN,
+    MCT_DRACONIAN_JOB,
+    MCT_DEMONSPAWN,
+    MCT_DEMONSPAWN_JOB,
+    MCT_ZOMBIFIED,          // zombies, skeletons, simulacra, spectral things
+    MCT_SLIME,              // as far as Jiyva is concerned
+    MCT_PLANT,
+    MCT_BLOOD,
+    MCT_SENSED,
+    MCT_STATIONARY,
+    MCT_UNIQUE,
+    MCT_PGHOST,
+    MCT_ANCESTOR,           // Hepliaklqana's
+    MCT_STATUE,
+    MCT_HYBRID,
+    MCT_ANIMATED_WEAPON,
+    MCT_HYDRA,              // of the hydra genus
+    MCT_CONJURED,
+    NUM_MON_CLASS_TRAITS
+};
+
+typedef uint64_t mon_class_trait_mask;
+static_assert(NUM_MON_CLASS_TRAITS <= 64, "too many traits for the mask");
+
+constexpr mon_class_trait_mask mct_bit(mon_class_trait trait)
+{
+    return mon_class_trait_mask(1) << trait;
+}
+
+struct mon_class_traits
+{
+    mon_class_trait_mask mask;
+    monster_type genus;         // as in mondata: mons_genus() also handles
+    monster_type species;       // the random types and player illusions
+    mon_holy_type holiness;
+    size_type size;
+};
+
+// Types out of range have no traits.
+const mon_class_traits &mons_class_traits(monster_type mc);
+
+// Does mc have any of the traits in mask?
+bool mons_class_has_trait(monster_type mc, mon_class_trait_mask mask);
+
+// Every type with all the traits in all and none of those in none.
+vector<monster_type> mons_classes_with_traits(mon_class_trait_mask all,
+                                              mon_class_trait_mask none = 0);
+
+// The trait masks of count types at once, e.g. for a whole monster list.
+void mons_class_trait_masks(const monster_type *types, size_t count,
+                            mon_class_trait_mask *masks);
+
+// What mons_avg_hp(), mons_max_hp() and exper_value() need of a class,
+// worked out once.
+struct mon_class_stats
+{
+    int avg_hp;             // mons_avg_hp()
+    int max_hp;             // mons_max_hp() with no base type
+    int melee_damage;       // of all the attacks together
+    int exp_mod;
+    bool gives_xp;
+    bool fast_regen;
+};
+
+// Types out of range have none.
+const mon_class_stats &mons_class_stats(monster_type mc);
+
 bool give_monster_proper_name(monster& mon, bool orcs_only = true);
 
 bool mons_flattens_trees(const monster& mon);
@@ -254,6 +341,26 @@ bool mons_class_sees_invis(monster_type type, monster_type base);
 bool mons_immune_magic(const monster& mon);
 
 mon_attack_def mons_attack_spec(const monster& mon, int attk_number, bool base_flavour = false);
+
+// Which of a class's attack tables a monster uses.
+enum mon_attack_variant
+{
+    MAV_NORMAL,
+    MAV_DERIVED,        // zombies, skeletons and spectral things
+    MAV_SIMULACRUM,
+    NUM_MON_ATTACK_VARIANTS
+};
+
+// mc's attack as that variant has it, before anything particular to one
+// monster: random types and flavours, merged slimes, draconian and
+// demonspawn bases.
+mon_attack_def mons_class_attack(monster_type mc, int attk_number,
+                                 mon_attack_variant variant = MAV_NORMAL);
+
+// The same attack of count classes at once, e.g. for a combat simulation.
+void mons_class_attacks(const monster_type *types, size_t count,
+                        int attk_number, mon_attack_variant variant,
+                        mon_attack_def *attacks);
 string mon_attack_name(attack_type attack, bool with_object = true);
 bool flavour_triggers_damageless(attack_flavour flavour);
 int flavour_damage(attack_flavour flavour, int HD, bool random = true);
@@ -484,6 +591,9 @@ monster_type demonspawn_base_by_name(const string &colour);
 mon_spell_slot drac_breath(monster_type drac_type);
 
 monster_type random_monster_at_grid(const coord_def& p, bool species = false);
+// As random_monster_at_grid(), count times over: for a level or an arena.
+void random_monsters_at_grid(const coord_def& p, monster_type *mons,
+                             size_t count, bool species = false);
 #endif
 
 void         init_mon_name_cache();
@@ -0,0 +1,258 @@
+/*
+ * monster-list-test.cc
+ * Check the incremental monster list: replaying its deltas on last turn's
+ * list must give this turn's. And streaming them, binary encoded.
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AppHdr.h"
+#include "monsters-inc.h"
+#include "mon-info.h"
+#include "mon-info-codec.h"
+#include "monster.h"
+#include "test-util.h"
+
+using namespace std;
+
+// monster_info::less_than needs the full game, so something like it
+static bool _less(const monster_info &m1, const monster_info &m2)
+{
+    if (m1.attitude != m2.attitude)
+        return m1.attitude < m2.attitude;
+    if (m1.type != m2.type)
+        return m1.type < m2.type;
+    return m1.mname < m2.mname;
+}
+
+static monster_info _info(uint32_t id, monster_type type)
+{
+    monster_info mi(type);
+    mi.client_id = id;
+    return mi;
+}
+
+static vector<uint32_t> _ids(const monster_list &list)
+{
+    vector<uint32_t> ids;
+    for (const monster_info &mi : list.infos())
+        ids.push_back(mi.client_id);
+    return ids;
+}
+
+static const monster_info *_find(const monster_list &list, uint32_t id)
+{
+    for (const monster_info &mi : list.infos())
+        if (mi.client_id == id)
+            return &mi;
+    return nullptr;
+}
+
+// The list a client would have after the deltas.
+static void _apply(vector<uint32_t> &ids,
+                   const vector<monster_list_delta> &deltas)
+{
+    for (const monster_list_delta &delta : deltas)
+    {
+        switch (delta.type)
+        {
+        case MLD_REMOVE:
+            ids.erase(ids.begin() + delta.index);
+            break;
+        case MLD_UPDATE:
+            ids.erase(ids.begin() + delta.old_index);
+            ids.insert(ids.begin() + delta.index, delta.id);
+            break;
+        case MLD_INSERT:
+            ids.insert(ids.begin() + delta.index, delta.id);
+            break;
+        }
+    }
+}
+
+int main()
+{
+    const monster_type types[] =
+    {
+        MONS_ORC, MONS_GOBLIN, MONS_RAT, MONS_ORC_WARRIOR, MONS_KOBOLD,
+    };
+
+    monster_list list(_less);
+    vector<monster_list_delta> deltas;
+
+    // a first turn, and one where nothing happens
+    vector<monster_info> infos;
+    infos.push_back(_info(1, MONS_RAT));
+    infos.push_back(_info(2, MONS_ORC));
+    infos.push_back(_info(3, MONS_ORC));
+    list.update(infos, deltas);
+    check_result("monster list first", "3 3",
+                 to_string(deltas.size()) + " "
+                 + to_string(list.infos().size()));
+
+    for (const monster_info &mi : list.infos())
+        infos.push_back(mi);
+    deltas.clear();
+    list.update(infos, deltas);
+    check_result("monster list unchanged", "0", to_string(deltas.size()));
+
+    // one orc moves and gets confused: updated in place
+    for (const monster_info &mi : list.infos())
+        infos.push_back(mi);
+    for (monster_info &mi : infos)
+        if (mi.client_id == 3)
+        {
+            mi.pos = coord_def(5, 5);
+            mi.mb.set(MB_CONFUSED);
+        }
+    deltas.clear();
+    list.update(infos, deltas);
+    check_result("monster list update", "1 3 "
+                 + to_string(MIC_POS | MIC_FLAGS),
+                 to_string(deltas.size()) + " " + to_string(deltas[0].id)
+                 + " " + to_string(deltas[0].changes));
+
+    // random turns
+    mt19937 rng(42);
+    vector<monster_info> current(list.infos());
+    uint32_t next_id = 4;
+    int mismatches = 0, unsorted = 0, decode_errors = 0;
+    size_t total_deltas = 0, total_listed = 0;
+    size_t encoded_bytes = 0, name_bytes = 0;
+    monster_info_encoder encoder;
+    monster_info_decoder decoder;
+
+    // the client starts with the whole list
+    string start;
+    for (const monster_info &mi : list.infos())
+        encoder.encode(mi, start);
+    for (size_t pos = 0; pos < start.size();)
+        if (!decoder.decode(start, pos))
+        {
+            decode_errors++;
+            break;
+        }
+    for (int turn = 0; turn < 500; turn++)
+    {
+        vector<uint32_t> client = _ids(list);
+
+        // some leave, some change, some arrive
+        vector<monster_info> next;
+        for (monster_info &mi : current)
+        {
+            const int roll = rng() % 10;
+            if (roll == 0)
+                continue;
+            if (roll == 1)
+            {
+                mi.attitude = (mon_attitude_type)(rng() % 3);
+                mi.mname = rng() % 2 ? "" : "Bob";
+                mi.pos = coord_def(rng() % 10, rng() % 10);
+            }
+            next.push_back(mi);
+        }
+        for (int i = rng() % 3; i > 0; i--)
+            next.push_back(_info(next_id++, types[rng() % 5]));
+        shuffle(next.begin(), next.end(), rng);
+        current = next;
+
+        deltas.clear();
+        list.update(next, deltas);
+        total_deltas += deltas.size();
+        total_listed += list.infos().size();
+
+        _apply(client, deltas);
+        if (client != _ids(list))
+            mismatches++;
+        if (!is_sorted(list.infos().begin(), list.infos().end(), _less))
+            unsorted++;
+
+        for (const monster_info &mi : current)
+        {
+            const monster_info *listed = _find(list, mi.client_id);
+            if (!listed || monster_info_changes(*listed, mi))
+                mismatches++;
+        }
+
+        // send the changes, rather than the names of everything in view
+        string stream;
+        for (const monster_list_delta &delta : deltas)
+        {
+            if (delta.type == MLD_REMOVE)
+                encoder.encode_gone(delta.id, stream);
+            else
+                encoder.encode(*_find(list, delta.id), stream);
+        }
+        encoded_bytes += stream.size();
+        for (const monster_info &mi : list.infos())
+            name_bytes += mi.full_name(DESC_A).size();
+
+        size_t pos = 0;
+        while (pos < stream.size())
+            if (!decoder.decode(stream, pos))
+            {
+                decode_errors++;
+                break;
+            }
+        for (const monster_info &mi : list.infos())
+        {
+            const monster_info *decoded = decoder.find(mi.client_id);
+            if (!decoded || monster_info_changes(*decoded, mi))
+                decode_errors++;
+        }
+    }
+    check_result("monster list deltas", "0 0",
+                 to_string(mismatches) + " " + to_string(unsorted));
+    // only the monsters which came, went or changed
+    check_result("monster list sparse", "true",
+                 total_deltas * 3 < total_listed ? "true" : "false");
+
+    check_result("monster stream", "0", to_string(decode_errors));
+    // smaller than just the English names of the whole list, every turn
+    check_result("monster stream size", "true",
+                 encoded_bytes * 3 < name_bytes ? "true" : "false");
+
+    // a changed flag costs a few bytes; damaged data is refused
+    monster_info_encoder enc;
+    monster_info_decoder dec;
+    monster_info orc = _info(7, MONS_ORC);
+    orc.mname = "Blork";
+    string full, delta;
+    enc.encode(orc, full);
+    orc.mb.set(MB_BERSERK);
+    enc.encode(orc, delta);
+    size_t pos = 0;
+    const bool truncated = dec.decode(full.substr(0, full.size() - 1), pos);
+    pos = 0;
+    dec.decode(full, pos);
+    pos = 0;
+    dec.decode(delta, pos);
+    const monster_info *got = dec.find(7);
+    check_result("monster stream delta", "5 false Blork true",
+                 to_string(delta.size()) + (truncated ? " true " : " false ")
+                 + (got ? got->mname : "")
+                 + (got && got->is(MB_BERSERK) ? " true" : " false"));
+
+    // a pool reuses its infos after reset(), without what they last held
+    monster named, plain;
+    named.type = MONS_ORC;
+    named.mname = "Blork";
+    named.colour = plain.colour = 0;
+    plain.type = MONS_GOBLIN;
+    monster_info_pool pool;
+    monster_info *first = &pool.acquire(&named);
+    first->constricting_name.push_back("the goblin");
+    first->inv[MSLOT_WEAPON].reset(new item_def());
+    pool.reset();
+    const monster_info *reused = &pool.acquire(&plain);
+    check_result("monster info pool", "1 true [] 0 false",
+                 to_string(pool.size())
+                 + (reused == first ? " true [" : " false [") + reused->mname
+                 + "] " + to_string(reused->constricting_name.size())
+                 + (reused->inv[MSLOT_WEAPON] ? " true" : " false"));
+
+    return 0;
+}
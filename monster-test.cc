@@ -5,10 +5,12 @@
 #include <vector>
 
 #include "localize.h"
+#include "xlate-profile.h"
 
 #include "monsters-inc.h"
 #include "english.h"
 #include "stringutil.h"
+#include "test-util.h"
 
 using namespace std;
 
@@ -135,5 +137,33 @@ int main(int argc, char *argv[])
         cout << sentence << endl;
 }
 
+    // the precomputed name forms, against working them out as above
+    int name_mismatches = 0;
+    for (monster_type i = MONS_PROGRAM_BUG; i < NUM_MONSTERS; i++)
+    {
+        const monsterentry* mon_def = get_monster_data(i);
+        if (mon_def == NULL || mon_def->genus == MONS_PROGRAM_BUG)
+            continue;
+
+        const string english_name(mon_def->name);
+        const mon_name_forms &names = mons_name_forms(i);
+        // (uniques don't take articles)
+        if (names.plain != english_name
+            || names.plural != pluralise(english_name)
+            || names.possessive != apostrophise(english_name)
+            || (!mons_is_unique(i)
+                && (names.a != article_a(english_name)
+                    || names.the != "the " + english_name)))
+        {
+            cout << "Name forms differ: " << english_name << endl;
+            name_mismatches++;
+        }
+    }
+    cout << endl;
+    check_result("name forms", "0", to_string(name_mismatches));
+
+    if (xlate_profile_enabled())
+        cout << endl << xlate_profile_dump(10);
+
     return 0;
 }
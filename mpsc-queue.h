@@ -0,0 +1,77 @@
+/**
+ * @file
+ * @brief Unbounded lock-free multi-producer, single-consumer queue.
+ *
+ * Any number of threads may push() concurrently without locking. Only one
+ * thread at a time may pop(); callers with several consumers must serialise
+ * pop() themselves.
+ *
+ * This is Dmitry Vyukov's node-based MPSC queue: push() is a single atomic
+ * exchange. A pop() may briefly report the queue empty while a push() is
+ * half done; the element is seen by a later pop().
+**/
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+template <class T> class mpsc_queue
+{
+public:
+    mpsc_queue()
+    {
+        node *stub = new node();
+        m_head.store(stub, std::memory_order_relaxed);
+        m_tail = stub;
+    }
+
+    ~mpsc_queue()
+    {
+        while (m_tail)
+        {
+            node *next = m_tail->next.load(std::memory_order_relaxed);
+            delete m_tail;
+            m_tail = next;
+        }
+    }
+
+    mpsc_queue(const mpsc_queue&) = delete;
+    mpsc_queue& operator=(const mpsc_queue&) = delete;
+
+    void push(T value)
+    {
+        node *n = new node();
+        n->value = std::move(value);
+        node *prev = m_head.exchange(n, std::memory_order_acq_rel);
+        prev->next.store(n, std::memory_order_release);
+    }
+
+    // returns false if nothing is (yet) available
+    bool pop(T &value)
+    {
+        node *next = m_tail->next.load(std::memory_order_acquire);
+        if (!next)
+            return false;
+
+        // next becomes the new stub
+        value = std::move(next->value);
+        delete m_tail;
+        m_tail = next;
+        return true;
+    }
+
+private:
+    struct node
+    {
+        std::atomic<node*> next;
+        T value;
+
+        node() : next(nullptr), value() {}
+    };
+
+    // producers push here
+    std::atomic<node*> m_head;
+    // consumer pops from here (always points at a stub)
+    node *m_tail;
+};
@@ -0,0 +1,236 @@
+/**
+ * @file
+ * @brief Replace several substrings at once, in a single pass.
+**/
+
+#include "AppHdr.h"
+#include "multi-replace.h"
+
+#include <deque>
+
+#include "debug.h"
+
+multi_replacer::multi_replacer(const vector<pair<string, string>> &pats)
+{
+    for (const auto &pat : pats)
+        add_pattern(pat.first, pat.second);
+    compile();
+}
+
+void multi_replacer::add(const string &pattern, const string &replacement)
+{
+    add_pattern(pattern, replacement);
+    compile();
+}
+
+void multi_replacer::add_pattern(const string &pattern,
+                                 const string &replacement)
+{
+    ASSERT(!pattern.empty());
+    for (const auto &pat : patterns)
+        if (pat.first == pattern)
+            return;
+    patterns.emplace_back(pattern, replacement);
+}
+
+// Build the automaton as a full transition table. Bytes which don't occur
+// in any pattern share class 0, which keeps the table small.
+void multi_replacer::compile()
+{
+    // (replace_single() doesn't need any tables)
+    if (patterns.size() == 1)
+        return;
+
+    memset(byte_class, 0, sizeof(byte_class));
+    num_classes = 1;
+    all_chars = true;
+    for (const auto &pat : patterns)
+    {
+        for (unsigned char c : pat.first)
+            if (!byte_class[c])
+                byte_class[c] = num_classes++;
+        if (pat.first.length() > 1)
+            all_chars = false;
+    }
+
+    // the trie
+    nodes.assign(1, node());
+    delta.assign(num_classes, -1);
+    for (size_t i = 0; i < patterns.size(); i++)
+    {
+        int state = 0;
+        for (unsigned char c : patterns[i].first)
+        {
+            int &next = delta[state * num_classes + byte_class[c]];
+            if (next < 0)
+            {
+                next = nodes.size();
+                node child;
+                child.depth = nodes[state].depth + 1;
+                nodes.push_back(child);
+                delta.resize(nodes.size() * num_classes, -1);
+            }
+            // (delta may have moved)
+            state = delta[state * num_classes + byte_class[c]];
+        }
+        nodes[state].pattern = i;
+    }
+
+    // Fill in the missing transitions breadth first, following fail links,
+    // so each step of the scan is a single lookup.
+    vector<int> fail(nodes.size(), 0);
+    deque<int> queue;
+    for (int cls = 0; cls < num_classes; cls++)
+    {
+        int &next = delta[cls];
+        if (next < 0)
+            next = 0;
+        else
+            queue.push_back(next);
+    }
+    nodes[0].output = -1;
+    while (!queue.empty())
+    {
+        const int state = queue.front();
+        queue.pop_front();
+
+        node &n = nodes[state];
+        n.output = n.pattern >= 0 ? state : nodes[fail[state]].output;
+
+        for (int cls = 0; cls < num_classes; cls++)
+        {
+            int &next = delta[state * num_classes + cls];
+            const int fallback = delta[fail[state] * num_classes + cls];
+            if (next < 0)
+                next = fallback;
+            else
+            {
+                fail[next] = fallback;
+                queue.push_back(next);
+            }
+        }
+    }
+}
+
+// one pattern: just find it
+size_t multi_replacer::replace_single(const string &text, string &out) const
+{
+    const string &find = patterns[0].first;
+    const string &repl = patterns[0].second;
+    size_t count = 0;
+    string::size_type last = 0;
+    string::size_type found;
+    while ((found = text.find(find, last)) != string::npos)
+    {
+        out.append(text, last, found - last);
+        out += repl;
+        last = found + find.length();
+        count++;
+    }
+    out.append(text, last, string::npos);
+    return count;
+}
+
+// only single bytes: no need for the automaton beyond the first step
+size_t multi_replacer::replace_chars(const string &text, string &out) const
+{
+    size_t count = 0;
+    string::size_type last = 0;
+    for (string::size_type i = 0; i < text.length(); i++)
+    {
+        const int cls = byte_class[static_cast<unsigned char>(text[i])];
+        if (!cls)
+            continue;
+        out.append(text, last, i - last);
+        out += patterns[nodes[delta[cls]].pattern].second;
+        last = i + 1;
+        count++;
+    }
+    out.append(text, last, string::npos);
+    return count;
+}
+
+size_t multi_replacer::replace(const string &text, string &out) const
+{
+    if (patterns.empty())
+    {
+        out += text;
+        return 0;
+    }
+    if (patterns.size() == 1)
+        return replace_single(text, out);
+    if (all_chars)
+        return replace_chars(text, out);
+
+    const size_t len = text.length();
+    size_t last = 0;        // start of text not yet copied to out
+    size_t pos = 0;
+    int state = 0;
+
+    // best match found so far, kept until no earlier or longer match
+    // could still be in progress
+    int best = -1;
+    size_t best_start = 0;
+    size_t best_len = 0;
+    size_t count = 0;
+
+    while (true)
+    {
+        if (state == 0)
+        {
+            // skip bytes which can't start a match
+            while (pos < len
+                   && !delta[byte_class[static_cast<unsigned char>(text[pos])]])
+            {
+                pos++;
+            }
+        }
+
+        if (pos < len)
+        {
+            state = delta[state * num_classes
+                          + byte_class[static_cast<unsigned char>(text[pos])]];
+            pos++;
+
+            // The first output on the chain is the longest pattern ending
+            // here, so also the earliest starting.
+            const int output = nodes[state].output;
+            if (output >= 0)
+            {
+                const size_t match_len = nodes[output].depth;
+                const size_t match_start = pos - match_len;
+                if (best < 0 || match_start < best_start
+                    || (match_start == best_start && match_len > best_len))
+                {
+                    best = nodes[output].pattern;
+                    best_start = match_start;
+                    best_len = match_len;
+                }
+            }
+
+            // anything still in progress started at pos - depth
+            if (best < 0 || pos - nodes[state].depth <= best_start)
+                continue;
+        }
+        else if (best < 0)
+            break;
+
+        out.append(text, last, best_start - last);
+        out += patterns[best].second;
+        last = pos = best_start + best_len;
+        state = 0;
+        best = -1;
+        count++;
+    }
+
+    out.append(text, last, string::npos);
+    return count;
+}
+
+string multi_replacer::replace(const string &text) const
+{
+    string out;
+    out.reserve(text.length());
+    replace(text, out);
+    return out;
+}
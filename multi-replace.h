@@ -0,0 +1,61 @@
+/**
+ * @file
+ * @brief Replace several substrings at once, in a single pass.
+**/
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+using std::string;
+using std::vector;
+
+/**
+ * A set of patterns and their replacements, compiled into an Aho-Corasick
+ * automaton so that text can be scanned for all of them at once.
+ *
+ * Matches are leftmost-longest and don't overlap: at each point the
+ * earliest-starting pattern wins, then the longest. Replacements are not
+ * rescanned. Build once and keep it (e.g. as a static) if the same patterns
+ * are used repeatedly.
+ */
+class multi_replacer
+{
+public:
+    multi_replacer() = default;
+    multi_replacer(const vector<std::pair<string, string>> &patterns);
+
+    // Patterns must be non-empty. If a pattern is added twice, the first
+    // replacement is used. Recompiles, so prefer the constructor for big sets.
+    void add(const string &pattern, const string &replacement);
+
+    // Replace matches in text, appending the result to out.
+    // Returns the number of replacements.
+    size_t replace(const string &text, string &out) const;
+    string replace(const string &text) const;
+
+    bool empty() const { return patterns.empty(); }
+
+private:
+    struct node
+    {
+        int pattern = -1;       // index of the pattern ending here, or -1
+        int output = -1;        // nearest node on the fail chain with a pattern
+        int depth = 0;
+    };
+
+    void add_pattern(const string &pattern, const string &replacement);
+    void compile();
+    size_t replace_single(const string &text, string &out) const;
+    size_t replace_chars(const string &text, string &out) const;
+
+    vector<std::pair<string, string>> patterns;
+
+    // (compiled eagerly, so a const replacer can be shared between threads)
+    bool all_chars = false;         // every pattern is one byte
+    vector<node> nodes;
+    vector<int> delta;              // [node * num_classes + class]
+    unsigned char byte_class[256] = {};
+    int num_classes = 0;
+};
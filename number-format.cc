@@ -0,0 +1,392 @@
+/**
+ * @file
+ * @brief printf-style formatting of single values, appending straight to a
+ *        string, with the punctuation of the current language.
+**/
+
+#include "AppHdr.h"
+#include "number-format.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+#include "stringutil.h"
+
+static const struct
+{
+    const char *lang;
+    number_punctuation punct;
+} _language_punctuation[] =
+{
+    { "de", { ',', '.' } },
+};
+
+static const number_punctuation _default_punctuation = { '.', ',' };
+
+const number_punctuation &language_punctuation(const string &lang)
+{
+    for (const auto &entry : _language_punctuation)
+    {
+        if (lang == entry.lang || starts_with(lang, string(entry.lang) + "_"))
+            return entry.punct;
+    }
+    return _default_punctuation;
+}
+
+bool parse_format_spec(const string &spec, format_spec &result)
+{
+    result = format_spec();
+    const char *p = spec.c_str();
+    if (*p++ != '%')
+        return false;
+
+    for (;; p++)
+    {
+        if (*p == '-')
+            result.left = true;
+        else if (*p == '+')
+            result.plus = true;
+        else if (*p == ' ')
+            result.space = true;
+        else if (*p == '#')
+            result.alt = true;
+        else if (*p == '0')
+            result.zero = true;
+        else if (*p == '\'')
+            result.group = true;
+        else
+            break;
+    }
+
+    // (* would need another arg)
+    for (; *p >= '0' && *p <= '9'; p++)
+        result.width = result.width * 10 + (*p - '0');
+
+    if (*p == '.')
+    {
+        result.precision = 0;
+        for (p++; *p >= '0' && *p <= '9'; p++)
+            result.precision = result.precision * 10 + (*p - '0');
+    }
+
+    if (p[0] == 'h' && p[1] == 'h')
+        result.length = 'H', p += 2;
+    else if (p[0] == 'l' && p[1] == 'l')
+        result.length = 'q', p += 2;
+    else if (*p == 'h' || *p == 'l' || *p == 'L')
+        result.length = *p++;
+
+    result.conv = *p++;
+    return *p == '\0' && result.conv && strchr("diuxXocseEfFgG", result.conv);
+}
+
+// "00" "01" ... "99"
+static const char _digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Write the digits of value backwards from end, returning the start.
+static char *_decimal_digits(char *end, unsigned long long value)
+{
+    char *p = end;
+    while (value >= 100)
+    {
+        const unsigned pair = (value % 100) * 2;
+        value /= 100;
+        *--p = _digit_pairs[pair + 1];
+        *--p = _digit_pairs[pair];
+    }
+    if (value >= 10)
+    {
+        *--p = _digit_pairs[value * 2 + 1];
+        *--p = _digit_pairs[value * 2];
+    }
+    else
+        *--p = '0' + value;
+    return p;
+}
+
+static char *_radix_digits(char *end, unsigned long long value, int shift,
+                           bool upper)
+{
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    const unsigned mask = (1 << shift) - 1;
+    char *p = end;
+    do
+    {
+        *--p = digits[value & mask];
+        value >>= shift;
+    }
+    while (value);
+    return p;
+}
+
+static void _append_grouped(string &out, const char *digits, size_t len,
+                            char sep)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (i && (len - i) % 3 == 0)
+            out += sep;
+        out += digits[i];
+    }
+}
+
+static size_t _grouped_length(size_t len)
+{
+    return len + (len ? (len - 1) / 3 : 0);
+}
+
+// Pad and append: prefix (sign, 0x), then zeros, then the body.
+// The body's length is given, since grouping adds to it as it's written.
+template <class F>
+static void _append_padded(string &out, const format_spec &spec,
+                           const char *prefix, size_t prefix_len,
+                           size_t zeros, size_t body_len, bool zero_pad,
+                           F write_body)
+{
+    const size_t len = prefix_len + zeros + body_len;
+    const size_t pad = spec.width > (int)len ? spec.width - len : 0;
+
+    if (!spec.left && !zero_pad)
+        out.append(pad, ' ');
+    out.append(prefix, prefix_len);
+    if (!spec.left && zero_pad)
+        out.append(pad, '0');
+    out.append(zeros, '0');
+    write_body();
+    if (spec.left)
+        out.append(pad, ' ');
+}
+
+static void _format_integer(string &out, unsigned long long magnitude,
+                            bool negative, const format_spec &spec,
+                            const number_punctuation &punct)
+{
+    char buf[32];
+    char *end = buf + sizeof(buf);
+    char *digits;
+    char prefix[3];
+    size_t prefix_len = 0;
+
+    if (negative)
+        prefix[prefix_len++] = '-';
+    else if (spec.plus && strchr("di", spec.conv))
+        prefix[prefix_len++] = '+';
+    else if (spec.space && strchr("di", spec.conv))
+        prefix[prefix_len++] = ' ';
+
+    switch (spec.conv)
+    {
+    case 'x':
+    case 'X':
+        digits = _radix_digits(end, magnitude, 4, spec.conv == 'X');
+        if (spec.alt && magnitude)
+        {
+            prefix[prefix_len++] = '0';
+            prefix[prefix_len++] = spec.conv;
+        }
+        break;
+    case 'o':
+        digits = _radix_digits(end, magnitude, 3, false);
+        break;
+    default:
+        digits = _decimal_digits(end, magnitude);
+        break;
+    }
+
+    size_t len = end - digits;
+    // precision 0 prints nothing for 0
+    if (spec.precision == 0 && magnitude == 0)
+        len = 0;
+
+    size_t zeros = spec.precision > (int)len ? spec.precision - len : 0;
+    // # with octal means there's always a leading 0
+    if (spec.conv == 'o' && spec.alt && zeros == 0
+        && (len == 0 || digits[0] != '0'))
+    {
+        zeros = 1;
+    }
+
+    const bool group = spec.group && strchr("diu", spec.conv);
+    const size_t body_len = group ? _grouped_length(len) : len;
+    _append_padded(out, spec, prefix, prefix_len, zeros, body_len,
+                   spec.zero && spec.precision < 0,
+                   [&]
+                   {
+                       if (group)
+                           _append_grouped(out, digits, len, punct.thousands_sep);
+                       else
+                           out.append(digits, len);
+                   });
+}
+
+void format_signed(string &out, long long value, const format_spec &spec,
+                   const number_punctuation &punct)
+{
+    if (spec.length == 'H')
+        value = static_cast<signed char>(value);
+    else if (spec.length == 'h')
+        value = static_cast<short>(value);
+
+    if (spec.conv == 'c')
+    {
+        const char c = static_cast<char>(value);
+        _append_padded(out, spec, nullptr, 0, 0, 1, false,
+                       [&] { out += c; });
+        return;
+    }
+
+    // (negate as unsigned, so LLONG_MIN works)
+    const unsigned long long magnitude
+        = value < 0 ? 0ULL - static_cast<unsigned long long>(value) : value;
+    _format_integer(out, magnitude, value < 0, spec, punct);
+}
+
+void format_unsigned(string &out, unsigned long long value,
+                     const format_spec &spec, const number_punctuation &punct)
+{
+    if (spec.length == 'H')
+        value = static_cast<unsigned char>(value);
+    else if (spec.length == 'h')
+        value = static_cast<unsigned short>(value);
+    else if (spec.length == 0)
+        value = static_cast<unsigned int>(value);
+
+    _format_integer(out, value, false, spec, punct);
+}
+
+void format_float(string &out, long double value, bool is_long,
+                  const format_spec &spec, const number_punctuation &punct)
+{
+    if (spec.alt)
+    {
+        // (# changes the trailing zeros and points; leave it to vsnprintf)
+        string fmt = "%#";
+        if (spec.left)
+            fmt += '-';
+        if (spec.plus)
+            fmt += '+';
+        if (spec.space)
+            fmt += ' ';
+        if (spec.zero)
+            fmt += '0';
+        if (spec.width)
+            fmt += to_string(spec.width);
+        if (spec.precision >= 0)
+            fmt += "." + to_string(spec.precision);
+        if (is_long)
+            fmt += 'L';
+        fmt += spec.conv;
+        string s = is_long ? make_stringf(fmt.c_str(), value)
+                           : make_stringf(fmt.c_str(), (double)value);
+        if (punct.decimal_point != '.')
+            replace(s.begin(), s.end(), '.', punct.decimal_point);
+        out += s;
+        return;
+    }
+
+    const bool upper = (spec.conv == 'E' || spec.conv == 'F'
+                        || spec.conv == 'G');
+
+    char prefix[1];
+    size_t prefix_len = 0;
+    if (signbit(value))
+        prefix[prefix_len++] = '-';
+    else if (spec.plus)
+        prefix[prefix_len++] = '+';
+    else if (spec.space)
+        prefix[prefix_len++] = ' ';
+
+    const long double magnitude = fabsl(value);
+    if (!isfinite(magnitude))
+    {
+        const char *text = isnan(magnitude) ? (upper ? "NAN" : "nan")
+                                            : (upper ? "INF" : "inf");
+        _append_padded(out, spec, prefix, prefix_len, 0, 3, false,
+                       [&] { out += text; });
+        return;
+    }
+
+    chars_format format;
+    switch (spec.conv)
+    {
+    case 'e':
+    case 'E':
+        format = chars_format::scientific;
+        break;
+    case 'f':
+    case 'F':
+        format = chars_format::fixed;
+        break;
+    default:
+        format = chars_format::general;
+        break;
+    }
+    const int precision = spec.precision < 0 ? 6 : spec.precision;
+
+    // big enough for anything but huge %f (which could be thousands of digits)
+    char small[128];
+    string big;
+    char *buf = small;
+    size_t size = sizeof(small);
+    to_chars_result res;
+    while (true)
+    {
+        res = is_long ? to_chars(buf, buf + size, magnitude, format, precision)
+                      : to_chars(buf, buf + size, (double)magnitude, format,
+                                 precision);
+        if (res.ec == errc())
+            break;
+        size *= 8;
+        big.resize(size);
+        buf = &big[0];
+    }
+
+    size_t len = res.ptr - buf;
+    if (upper)
+    {
+        for (size_t i = 0; i < len; i++)
+            buf[i] = toupper(buf[i]);
+    }
+
+    // length of the integer part, for grouping
+    const char *point = static_cast<const char*>(memchr(buf, '.', len));
+    size_t int_len = point ? point - buf : len;
+    for (size_t i = 0; i < int_len; i++)
+    {
+        if (buf[i] == 'e' || buf[i] == 'E')
+        {
+            int_len = i;
+            break;
+        }
+    }
+
+    const bool group = spec.group && format != chars_format::scientific;
+    const size_t body_len = group ? len + _grouped_length(int_len) - int_len
+                                  : len;
+    _append_padded(out, spec, prefix, prefix_len, 0, body_len, spec.zero,
+                   [&]
+                   {
+                       size_t i = 0;
+                       if (group)
+                       {
+                           _append_grouped(out, buf, int_len,
+                                           punct.thousands_sep);
+                           i = int_len;
+                       }
+                       for (; i < len; i++)
+                           out += buf[i] == '.' ? punct.decimal_point : buf[i];
+                   });
+}
+
+void format_string(string &out, const string &value, const format_spec &spec)
+{
+    size_t len = value.length();
+    if (spec.precision >= 0 && (size_t)spec.precision < len)
+        len = spec.precision;
+    _append_padded(out, spec, nullptr, 0, 0, len, false,
+                   [&] { out.append(value, 0, len); });
+}
@@ -0,0 +1,61 @@
+/**
+ * @file
+ * @brief printf-style formatting of single values, appending straight to a
+ *        string, with the punctuation of the current language.
+ *
+ * Handles what localize() needs: d/i/u/x/X/o/c/s and e/E/f/F/g/G, with the
+ * flags - + space # 0 and ' (group thousands), width and precision. Other
+ * conversions are left to vsnprintf.
+**/
+
+#pragma once
+
+#include <string>
+using std::string;
+
+struct format_spec
+{
+    bool left = false;      // -
+    bool plus = false;      // +
+    bool space = false;     // ' '
+    bool alt = false;       // #
+    bool zero = false;      // 0
+    bool group = false;     // '
+    int width = 0;
+    int precision = -1;     // -1 = not given
+    char length = 0;        // 'H' (hh), 'h', 'l', 'q' (ll), 'L', or 0
+    char conv = 0;
+};
+
+// spec is like "%-08.3lf" (no positional arg id)
+// returns false if it isn't something we can format
+bool parse_format_spec(const string &spec, format_spec &result);
+
+struct number_punctuation
+{
+    char decimal_point;
+    char thousands_sep;
+
+    bool operator==(const number_punctuation &other) const
+    {
+        return decimal_point == other.decimal_point
+               && thousands_sep == other.thousands_sep;
+    }
+    bool operator!=(const number_punctuation &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// for lang (e.g. a decimal comma for "de")
+const number_punctuation &language_punctuation(const string &lang);
+
+// The value must already be the type the spec calls for (e.g. an int for
+// "%d"); these only apply the hh/h length modifiers.
+void format_signed(string &out, long long value, const format_spec &spec,
+                   const number_punctuation &punct);
+void format_unsigned(string &out, unsigned long long value,
+                     const format_spec &spec, const number_punctuation &punct);
+void format_float(string &out, long double value, bool is_long,
+                  const format_spec &spec, const number_punctuation &punct);
+void format_string(string &out, const string &value, const format_spec &spec);
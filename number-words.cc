@@ -0,0 +1,218 @@
+/**
+ * @file
+ * @brief Cardinal numbers in words, in different languages.
+**/
+
+#include "AppHdr.h"
+#include "number-words.h"
+
+#include <stdint.h>
+
+#include "stringutil.h"
+
+// a power of a thousand
+struct number_period
+{
+    const char *one;        // "one thousand", "eine Million"
+    const char *singular;
+    const char *plural;
+    bool spaced;            // "one thousand two", but "eintausendzwei"
+};
+
+struct number_words_rules
+{
+    const char *lang;
+    const char *zero;
+    const char *units[20];      // standalone (index 0 unused)
+    const char *compound_one;   // one with something following ("ein")
+    const char *tens[10];
+    bool units_first;           // "einundzwanzig", not "twenty-one"
+    const char *tens_glue;
+    const char *hundred;
+    const char *space;          // between the hundreds and the rest
+    number_period periods[3];   // thousand, million, billion
+};
+
+static const number_words_rules _number_rules[] =
+{
+    {
+        "en", "zero",
+        {
+            "", "one", "two", "three", "four", "five", "six", "seven",
+            "eight", "nine", "ten", "eleven", "twelve", "thirteen",
+            "fourteen", "fifteen", "sixteen", "seventeen", "eighteen",
+            "nineteen"
+        },
+        "one",
+        {
+            "", "", "twenty", "thirty", "forty", "fifty", "sixty", "seventy",
+            "eighty", "ninety"
+        },
+        false, "-", "hundred", " ",
+        {
+            { nullptr, "thousand", "thousand", true },
+            { nullptr, "million", "million", true },
+            { nullptr, "billion", "billion", true },
+        },
+    },
+    {
+        "de", "null",
+        {
+            "", "eins", "zwei", "drei", "vier", "fünf", "sechs", "sieben",
+            "acht", "neun", "zehn", "elf", "zwölf", "dreizehn", "vierzehn",
+            "fünfzehn", "sechzehn", "siebzehn", "achtzehn", "neunzehn"
+        },
+        "ein",
+        {
+            "", "", "zwanzig", "dreißig", "vierzig", "fünfzig", "sechzig",
+            "siebzig", "achtzig", "neunzig"
+        },
+        true, "und", "hundert", "",
+        {
+            { "ein", "tausend", "tausend", false },
+            { "eine", "Million", "Millionen", true },
+            { "eine", "Milliarde", "Milliarden", true },
+        },
+    },
+};
+
+// 0..999 in one language, interned in one buffer
+struct small_number_table
+{
+    string text;
+    uint32_t start[SMALL_NUMBER_WORDS + 1];
+
+    string_view get(unsigned number) const
+    {
+        return string_view(text).substr(start[number],
+                                        start[number + 1] - start[number]);
+    }
+};
+
+static const number_words_rules &_get_rules(const string &lang)
+{
+    for (const number_words_rules &rules : _number_rules)
+    {
+        if (lang == rules.lang || starts_with(lang, string(rules.lang) + "_"))
+            return rules;
+    }
+    return _number_rules[0];
+}
+
+// 1..99
+static string _tens_in_words(const number_words_rules &rules, unsigned num)
+{
+    if (num < 20)
+        return rules.units[num];
+
+    const unsigned ten = num / 10, digit = num % 10;
+    if (!digit)
+        return rules.tens[ten];
+    else if (rules.units_first)
+    {
+        const char *unit = digit == 1 ? rules.compound_one : rules.units[digit];
+        return string(unit) + rules.tens_glue + rules.tens[ten];
+    }
+    else
+        return string(rules.tens[ten]) + rules.tens_glue + rules.units[digit];
+}
+
+// 1..999
+static string _hundreds_in_words(const number_words_rules &rules, unsigned num)
+{
+    const unsigned dreds = num / 100, tens = num % 100;
+    string words;
+    if (dreds)
+    {
+        words = dreds == 1 ? rules.compound_one : rules.units[dreds];
+        words += rules.space;
+        words += rules.hundred;
+    }
+    if (dreds && tens)
+        words += rules.space;
+    if (tens)
+        words += _tens_in_words(rules, tens);
+    return words;
+}
+
+static small_number_table *_build_table(const number_words_rules &rules)
+{
+    small_number_table *table = new small_number_table;
+    for (unsigned i = 0; i < SMALL_NUMBER_WORDS; i++)
+    {
+        table->start[i] = table->text.length();
+        table->text += i ? _hundreds_in_words(rules, i) : rules.zero;
+    }
+    table->start[SMALL_NUMBER_WORDS] = table->text.length();
+    return table;
+}
+
+static const small_number_table &_get_table(const number_words_rules &rules)
+{
+    // built the first time any language is used (thread-safe)
+    static const vector<small_number_table*> tables = []
+    {
+        vector<small_number_table*> built;
+        for (const number_words_rules &r : _number_rules)
+            built.push_back(_build_table(r));
+        return built;
+    }();
+    return *tables[&rules - _number_rules];
+}
+
+string_view small_number_in_words(unsigned number, const string &lang)
+{
+    ASSERT(number < SMALL_NUMBER_WORDS);
+    return _get_table(_get_rules(lang)).get(number);
+}
+
+// a group of three digits followed by something else
+static string _compound(const number_words_rules &rules, string_view group)
+{
+    // (einhunderteins -> einhundertein-tausend)
+    string words(group);
+    if (ends_with(words, rules.units[1]))
+    {
+        words.resize(words.length() - strlen(rules.units[1]));
+        words += rules.compound_one;
+    }
+    return words;
+}
+
+string number_in_words(unsigned number, const string &lang)
+{
+    const number_words_rules &rules = _get_rules(lang);
+    const small_number_table &table = _get_table(rules);
+    if (number < SMALL_NUMBER_WORDS)
+        return string(table.get(number));
+
+    string words;
+    // the last period in words (which says what goes after it)
+    const number_period *prev = nullptr;
+    unsigned divisor = 1000000000;
+    for (int p = ARRAYSZ(rules.periods); p >= 0; p--, divisor /= 1000)
+    {
+        const unsigned group = number / divisor % 1000;
+        if (!group)
+            continue;
+
+        if (prev)
+            words += prev->spaced ? " " : "";
+
+        if (p == 0)
+        {
+            words += table.get(group);
+            break;
+        }
+
+        const number_period &period = rules.periods[p - 1];
+        if (group == 1 && period.one)
+            words += period.one;
+        else
+            words += _compound(rules, table.get(group));
+        words += period.spaced ? " " : "";
+        words += group == 1 ? period.singular : period.plural;
+        prev = &period;
+    }
+    return words;
+}
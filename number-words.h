@@ -0,0 +1,21 @@
+/**
+ * @file
+ * @brief Cardinal numbers in words, in different languages.
+**/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+using std::string;
+using std::string_view;
+
+// Numbers below this are looked up in a table built once per language
+const unsigned SMALL_NUMBER_WORDS = 1000;
+
+// e.g. "three hundred forty-two" or "dreihundertzweiundvierzig"
+// Languages without rules get English.
+string number_in_words(unsigned number, const string &lang);
+
+// number must be < SMALL_NUMBER_WORDS
+string_view small_number_in_words(unsigned number, const string &lang);
@@ -0,0 +1,151 @@
+/*
+ * pluralise-test.cc
+ * Check pluralise_word() against the rule chain it replaced, and time both
+ * on every monster name
+ */
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "monsters-inc.h"
+#include "english.h"
+#include "stringutil.h"
+#include "test-util.h"
+
+using namespace std;
+
+// pluralise() as it was: one ends_with() after another
+static string _chain_pluralise_word(const string &name)
+{
+    if (ends_with(name, "us"))
+    {
+        if (ends_with(name, "lotus") || ends_with(name, "status"))
+            return name + "es";
+        else
+            return name.substr(0, name.length() - 2) + "i";
+    }
+    else if (ends_with(name, "larva") || ends_with(name, "antenna")
+             || ends_with(name, "hypha"))
+    {
+        return name + "e";
+    }
+    else if (ends_with(name, "ex"))
+        return name.substr(0, name.length() - 2) + "ices";
+    else if (ends_with(name, "mosquito") || ends_with(name, "ss"))
+        return name + "es";
+    else if (ends_with(name, "cyclops"))
+        return name.substr(0, name.length() - 1) + "es";
+    else if (name == "catoblepas")
+        return "catoblepae";
+    else if (ends_with(name, "s"))
+        return name;
+    else if (ends_with(name, "y"))
+    {
+        if (name == "y")
+            return "ys";
+        else if (is_vowel(name[name.length() - 2]))
+            return name + "s";
+        else
+            return name.substr(0, name.length() - 1) + "ies";
+    }
+    else if (ends_with(name, "fe"))
+        return name.substr(0, name.length() - 2) + "ves";
+    else if (ends_with(name, "staff"))
+        return name.substr(0, name.length() - 2) + "ves";
+    else if (ends_with(name, "f") && !ends_with(name, "ff"))
+        return name.substr(0, name.length() - 1) + "ves";
+    else if (ends_with(name, "mage"))
+        return name.substr(0, name.length() - 1) + "i";
+    else if (name == "gold"                 || ends_with(name, "fish")
+             || ends_with(name, "folk")     || ends_with(name, "spawn")
+             || ends_with(name, "tengu")    || ends_with(name, "sheep")
+             || ends_with(name, "swine")    || ends_with(name, "efreet")
+             || ends_with(name, "jiangshi") || ends_with(name, "raiju")
+             || ends_with(name, "meliai"))
+    {
+        return name;
+    }
+    else if (ends_with(name, "ch") || ends_with(name, "sh")
+             || ends_with(name, "x"))
+    {
+        return name + "es";
+    }
+    else if (ends_with(name, "simulacrum") || ends_with(name, "eidolon"))
+        return name.substr(0, name.length() - 2) + "a";
+    else if (ends_with(name, "djinni"))
+        return name.substr(0, name.length() - 1);
+    else if (name == "foot")
+        return "feet";
+    else if (name == "ophan" || name == "cherub" || name == "seraph")
+        return name + "im";
+    else if (ends_with(name, "arachi"))
+        return name + "m";
+    else if (name == "ushabti")
+        return name + "u";
+    else if (name == "Tzitzimitl")
+        return name.substr(0, name.length() - 2) + "meh";
+
+    return name + "s";
+}
+
+template <class F>
+static double _nanos_per_name(const vector<string> &names, F pluralise_fn)
+{
+    const int reps = 200;
+    size_t total = 0;
+    const auto start = chrono::steady_clock::now();
+    for (int i = 0; i < reps; i++)
+        for (const string &name : names)
+            total += pluralise_fn(name).length();
+    const auto elapsed = chrono::steady_clock::now() - start;
+
+    // (use the result, so the calls can't be optimised away)
+    if (total == 0)
+        cout << "no output?" << endl;
+    return chrono::duration<double, nano>(elapsed).count()
+           / (reps * names.size());
+}
+
+int main()
+{
+    vector<string> names;
+    for (monster_type mc = MONS_PROGRAM_BUG; mc < NUM_MONSTERS; mc++)
+    {
+        const monsterentry *me = get_monster_data(mc);
+        if (me && (mc == MONS_PROGRAM_BUG || me->mc != MONS_PROGRAM_BUG))
+            names.push_back(me->name);
+    }
+
+    // and the odd cases which no monster has (yet)
+    const char *others[] =
+    {
+        "", "y", "boy", "day", "jelly", "knife", "staff", "elf", "hippogriff",
+        "gold", "marigold", "foot", "ophan", "catoblepas", "lotus",
+        "ushabti", "Tzitzimitl", "sphinx", "bush", "glass", "Ay",
+    };
+    for (const char *other : others)
+        names.push_back(other);
+
+    int mismatches = 0;
+    for (const string &name : names)
+    {
+        const string expected = _chain_pluralise_word(name);
+        const string actual = pluralise_word(name);
+        if (actual != expected)
+        {
+            check_result("pluralise " + name, expected, actual);
+            mismatches++;
+        }
+    }
+    check_result("pluralise all names", "0", to_string(mismatches));
+
+    cout << names.size() << " names" << endl;
+    cout << "rule chain: " << _nanos_per_name(names, _chain_pluralise_word)
+         << " ns/name" << endl;
+    cout << "trie:       " << _nanos_per_name(names, pluralise_word)
+         << " ns/name" << endl;
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * random-alias-test.cc
+ * Check the alias tables pick in proportion to the weights
+ */
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AppHdr.h"
+#include "random-alias.h"
+#include "test-util.h"
+
+using namespace std;
+
+// Sweep r evenly over its range: each item should come up in proportion to
+// its weight, give or take the rounding of one step per column.
+static int _sweep_errors(const vector<pair<int, int>> &weighted)
+{
+    alias_table<int> table(weighted);
+    const uint64_t steps = 1 << 20;
+    vector<uint64_t> counts(weighted.size());
+    for (uint64_t i = 0; i < steps; i++)
+        counts[table.pick((i << 32) / steps)]++;
+
+    uint64_t total = 0;
+    for (const auto &entry : weighted)
+        total += max(entry.second, 0);
+
+    int errors = 0;
+    for (size_t i = 0; i < weighted.size(); i++)
+    {
+        const int64_t expected = steps * max(weighted[i].second, 0) / total;
+        if (llabs((int64_t)counts[i] - expected) > (int64_t)table.size() + 1)
+            errors++;
+    }
+    return errors;
+}
+
+int main()
+{
+    check_result("alias uniform", "0",
+                 to_string(_sweep_errors({{0, 1}, {1, 1}, {2, 1}})));
+    check_result("alias weighted", "0",
+                 to_string(_sweep_errors({{0, 1}, {1, 10}, {2, 100},
+                                          {3, 0}, {4, 7}, {5, -3}})));
+
+    // lots of items, very different weights
+    mt19937 rng(7);
+    vector<pair<int, int>> many;
+    for (int i = 0; i < 500; i++)
+        many.emplace_back(i, rng() % 3 ? rng() % 1000 : rng() % 1000000);
+    check_result("alias many", "0", to_string(_sweep_errors(many)));
+
+    alias_table<string> none({{"ogre", 0}});
+    check_result("alias empty", "true", none.empty() ? "true" : "false");
+
+    // the ends of r's range
+    alias_table<string> two({{"orc", 1}, {"goblin", 3}});
+    check_result("alias ends", "orc goblin",
+                 two.pick(0) + " " + two.pick(UINT32_MAX));
+
+    vector<string> drawn(1000);
+    two.pick_many(drawn.data(), drawn.size(), [&] { return rng(); });
+    int goblins = 0;
+    for (const string &name : drawn)
+        goblins += name == "goblin";
+    check_result("alias pick many", "true",
+                 goblins > 700 && goblins < 800 ? "true" : "false");
+
+    return 0;
+}
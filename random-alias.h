@@ -0,0 +1,142 @@
+/**
+ * @file
+ * @brief Weighted random choice in constant time, by Walker's alias method
+ *        (with Vose's construction).
+ *
+ * Every item gets a column of equal width. A column holds as much of its
+ * own item's weight as fits and tops up with some of one other item's
+ * weight (its alias). Drawing picks a column and then one of its two items,
+ * both from a single 32-bit random number: the column from the top bits of
+ * r * size, the choice within it from the bottom 32 bits.
+ *
+ * Building is O(n); the table is meant to be built once (per habitat,
+ * branch, depth...) and drawn from many times.
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using std::pair;
+using std::vector;
+
+template <typename T>
+class alias_table
+{
+public:
+    alias_table() { }
+
+    explicit alias_table(const vector<pair<T, int>> &weighted)
+    {
+        build(weighted);
+    }
+
+    // Items with weights no more than 0 are never picked. If there are no
+    // other items the table is empty.
+    void build(const vector<pair<T, int>> &weighted)
+    {
+        items.clear();
+        threshold.clear();
+        alias.clear();
+
+        uint64_t total = 0;
+        for (const auto &entry : weighted)
+        {
+            if (entry.second > 0)
+            {
+                items.push_back(entry.first);
+                total += entry.second;
+            }
+        }
+
+        const size_t n = items.size();
+        threshold.resize(n);
+        alias.resize(n);
+
+        // Each column holds total; an item needs weight * n of it. Integers
+        // all the way, so the table is exact and doesn't depend on the
+        // platform's rounding.
+        vector<uint64_t> need;
+        vector<uint32_t> small, large;
+        need.reserve(n);
+        for (const auto &entry : weighted)
+            if (entry.second > 0)
+                need.push_back((uint64_t)entry.second * n);
+        for (size_t i = 0; i < n; i++)
+            (need[i] < total ? small : large).push_back(i);
+
+        while (!small.empty() && !large.empty())
+        {
+            const uint32_t s = small.back();
+            const uint32_t l = large.back();
+            small.pop_back();
+
+            threshold[s] = _fraction(need[s], total);
+            alias[s] = l;
+
+            need[l] -= total - need[s];
+            if (need[l] < total)
+            {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+
+        // Whatever's left fills its own column.
+        for (uint32_t i : large)
+            _fill(i);
+        for (uint32_t i : small)
+            _fill(i);
+    }
+
+    bool empty() const { return items.empty(); }
+    size_t size() const { return items.size(); }
+
+    // The item for the 32-bit random number r. The table must not be empty.
+    T pick(uint32_t r) const
+    {
+        const uint64_t scaled = (uint64_t)r * items.size();
+        const uint32_t column = scaled >> 32;
+        return (uint32_t)scaled < threshold[column] ? items[column]
+                                                    : items[alias[column]];
+    }
+
+    // count items into out, with gen() giving a 32-bit random number each.
+    template <typename GEN>
+    void pick_many(T *out, size_t count, GEN &&gen) const
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = pick(gen());
+    }
+
+private:
+    // part / total of 2^32, where part < total.
+    static uint32_t _fraction(uint64_t part, uint64_t total)
+    {
+        uint64_t result = 0;
+        // long division a bit at a time, since part << 32 could overflow
+        for (int bit = 31; bit >= 0; bit--)
+        {
+            part <<= 1;
+            if (part >= total)
+            {
+                part -= total;
+                result |= uint64_t(1) << bit;
+            }
+        }
+        return result;
+    }
+
+    void _fill(uint32_t i)
+    {
+        threshold[i] = UINT32_MAX;
+        alias[i] = i;
+    }
+
+    vector<T> items;
+    vector<uint32_t> threshold;     // of 2^32: below it, the column's own item
+    vector<uint32_t> alias;
+};
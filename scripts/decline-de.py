@@ -492,11 +492,16 @@ def process(infile_name, case_long, article):
 #####################################
 # Main
 #####################################
-if len(sys.argv) != 2:
-    print("Usage: decline-de.py <input file>")
+args = sys.argv[1:]
+expand_all = "--all" in args
+if expand_all:
+    args.remove("--all")
+
+if len(args) != 1:
+    print("Usage: decline-de.py [--all] <input file>")
     sys.exit(1)
 
-infile_name = sys.argv[1]
+infile_name = args[0]
 
 outfile_name = "out.po"
 #os.remove(outfile_name)
@@ -505,10 +510,14 @@ outfile = open(outfile_name,"w+")
 print("Writing output to " + outfile_name + "...")
 
 process(infile_name, "nominative","definite")
-process(infile_name, "accusative","definite")
-process(infile_name, "dative", "definite")
-process(infile_name, "nominative", "indefinite")
-process(infile_name, "accusative", "indefinite")
-process(infile_name, "dative", "indefinite")
+
+# The other cases and the indefinite forms are declined at runtime
+# (german.cc), so only generate them with --all, e.g. to check the rules
+if expand_all:
+    process(infile_name, "accusative","definite")
+    process(infile_name, "dative", "definite")
+    process(infile_name, "nominative", "indefinite")
+    process(infile_name, "accusative", "indefinite")
+    process(infile_name, "dative", "indefinite")
 
 outfile.close()
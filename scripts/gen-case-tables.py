@@ -0,0 +1,102 @@
+######################################################################
+# Generate unicode-case-data.h: case mapping tables for unicode-case.cc
+# Uses the Unicode data of the Python running it (str.lower() etc. do
+# the full mappings from SpecialCasing.txt, without context).
+#
+# Usage: python3 scripts/gen-case-tables.py > unicode-case-data.h
+######################################################################
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x110000
+
+#####################################
+# Escape a string as a C literal
+#####################################
+def c_string(text):
+    return '"' + ''.join('\\x%02x' % b for b in text.encode('utf-8')) + '"'
+
+#####################################
+# Single code point mappings, as runs of code points with the same
+# delta, one or two apart. Runs don't overlap, so a binary search on
+# the first code point finds the only candidate.
+#####################################
+def simple_ranges(mapping):
+    ranges = []
+    cps = sorted(mapping)
+    i = 0
+    while i < len(cps):
+        first = cps[i]
+        delta = mapping[first] - first
+        count = 1
+        stride = 1
+        if i + 1 < len(cps) and mapping[cps[i + 1]] - cps[i + 1] == delta:
+            gap = cps[i + 1] - first
+            if gap == 1 or (gap == 2 and first + 1 not in mapping):
+                stride = gap
+        while i + count < len(cps) and count < 0xffff:
+            cp = cps[i + count]
+            expected = first + count * stride
+            if cp != expected or mapping[cp] - cp != delta:
+                break
+            if stride == 2 and expected - 1 in mapping:
+                break
+            count += 1
+        ranges.append((first, count, stride, delta))
+        i += count
+    return ranges
+
+def write_simple(name, ranges):
+    print('static const case_range %s[] =' % name)
+    print('{')
+    for first, count, stride, delta in ranges:
+        print('    { 0x%04x, %d, %d, %d },' % (first, count, stride, delta))
+    print('};')
+    print()
+
+def write_special(name, special):
+    print('static const case_special %s[] =' % name)
+    print('{')
+    for cp in sorted(special):
+        print('    { 0x%04x, %s }, // %s' % (cp, c_string(special[cp]),
+                                             unicodedata.name(chr(cp), '?')))
+    print('};')
+    print()
+
+def mappings(convert):
+    simple = {}
+    special = {}
+    for cp in range(0x80, MAX_CODE_POINT):
+        if 0xd800 <= cp < 0xe000:
+            continue
+        mapped = convert(chr(cp))
+        if mapped == chr(cp):
+            continue
+        if len(mapped) == 1:
+            simple[cp] = ord(mapped)
+        else:
+            special[cp] = mapped
+    return simple, special
+
+lower, lower_special = mappings(str.lower)
+upper, upper_special = mappings(str.upper)
+
+# Title case only where it differs from upper case
+title_special = {}
+for cp in range(0x80, MAX_CODE_POINT):
+    if 0xd800 <= cp < 0xe000:
+        continue
+    title = chr(cp).title()
+    if title != chr(cp).upper():
+        title_special[cp] = title
+
+print('// Generated by scripts/gen-case-tables.py from Unicode %s.'
+      % unicodedata.unidata_version)
+print('// Don\'t edit; rerun the script instead.')
+print('// (ASCII is handled separately, so starts at U+0080)')
+print()
+write_simple('lower_ranges', simple_ranges(lower))
+write_special('lower_special', lower_special)
+write_simple('upper_ranges', simple_ranges(upper))
+write_special('upper_special', upper_special)
+write_special('title_special', title_special)
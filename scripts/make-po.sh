@@ -11,4 +11,8 @@ fi
 python3 decline-de.py the-$NAME.po
 cp ./$NAME-header.po ../po/de/$NAME.po
 cat out.po >> ../po/de/$NAME.po
+if [ -f ./$NAME-exceptions.po ]
+then
+	cat ./$NAME-exceptions.po >> ../po/de/$NAME.po
+fi
 
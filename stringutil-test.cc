@@ -0,0 +1,135 @@
+/*
+ * stringutil-test.cc
+ * Check the string_view splitting and tag functions, and case mapping
+ */
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "libutil.h"
+#include "stringutil.h"
+#include "test-util.h"
+
+using namespace std;
+
+// split_string() as it was, erasing from the front of s
+static vector<string> _erasing_split_string(const string &sep, string s,
+                                            bool trim, bool accept_empty,
+                                            int nsplits)
+{
+    vector<string> segments;
+    auto add_segment = [&](string seg)
+    {
+        if (trim && !seg.empty())
+            trim_string(seg);
+        if (accept_empty || !seg.empty())
+            segments.push_back(seg);
+    };
+
+    string::size_type pos;
+    while (nsplits && (pos = s.find(sep)) != string::npos)
+    {
+        add_segment(s.substr(0, pos));
+        s.erase(0, pos + sep.length());
+        if (nsplits > 0)
+            --nsplits;
+    }
+    if (!s.empty())
+        add_segment(s);
+    return segments;
+}
+
+static string _join(const vector<string_view> &parts)
+{
+    string result;
+    for (string_view part : parts)
+    {
+        if (!result.empty())
+            result += "|";
+        result += part;
+    }
+    return result;
+}
+
+int main()
+{
+    check_result("trimmed view", "a b", string(trimmed_view(" \ta b\n")));
+    check_result("trimmed view blank", "", string(trimmed_view("  ")));
+
+    // every combination of options on some awkward strings
+    const char *texts[] =
+    {
+        "", " ", ",", "a", "a,b", ",a,,b,", " a , b ,c", "a,, ,b, ", ",,,",
+    };
+    int mismatches = 0;
+    for (const char *text : texts)
+        for (int trim = 0; trim < 2; trim++)
+            for (int empties = 0; empties < 2; empties++)
+                for (int nsplits = -1; nsplits < 3; nsplits++)
+                {
+                    const vector<string> expected
+                        = _erasing_split_string(",", text, trim, empties, nsplits);
+                    const vector<string_view> views
+                        = split_string_view(",", text, trim, empties, nsplits);
+                    if (split_string(",", text, trim, empties, nsplits) != expected
+                        || vector<string>(views.begin(), views.end()) != expected)
+                    {
+                        mismatches++;
+                    }
+                }
+    check_result("split views", "0", to_string(mismatches));
+    check_result("split view", "a|b|c",
+                 _join(split_string_view(",", " a, ,b ,c ")));
+    check_result("split view limit", "a|b ,c",
+                 _join(split_string_view(",", "a,b ,c", true, false, 1)));
+
+    string tags = "foo bar:1 bar:2 baz";
+    check_result("tag without prefix view", "1",
+                 string(tag_without_prefix_view(tags, "bar:")));
+    check_result("strip tag prefix", "1", strip_tag_prefix(tags, "bar:"));
+    check_result("strip tag", "true", strip_tag(tags, "baz") ? "true" : "false");
+    check_result("strip tag rest", "foo bar:2", tags);
+    check_result("strip tag padded", "false", strip_tag(tags, "ba") ? "true" : "false");
+
+    const tag_set set = parse_tag_set(" spiny  fly spiny cold ");
+    check_result("tag set", "cold|fly|spiny",
+                 string(set[0]) + "|" + string(set[1]) + "|" + string(set[2]));
+    const tag_set copy = set;
+    check_result("tag set contains", "true false",
+                 string(copy.contains("fly") ? "true" : "false")
+                 + (copy.contains("fl") ? " true" : " false"));
+    check_result("tag set matches parse_tags", to_string(parse_tags(" spiny  fly spiny cold ").size()),
+                 to_string(set.size()));
+
+    check_result("numcmp", "-1 1 0",
+                 to_string(numcmp(string_view("foo99bar"), string_view("foo123bar")))
+                 + " " + to_string(numcmp("0.10", "0.9", 2))
+                 + " " + to_string(numcmp(string("a007"), string("a7"))));
+
+    // case mapping, including mappings which change the length
+    check_result("uppercase", "DIE STRASSE DER ÄPFEL UND ÖFEN, ÜBER ALLES",
+                 uppercase_string("die Straße der Äpfel und Öfen, über alles"));
+    check_result("lowercase", "the quick brown ørc jumps over the lazy dragon",
+                 lowercase_string("The QUICK Brown ØRC jumps over THE LAZY DRAGON"));
+    check_result("lowercase dotted i", "i̇stanbul", lowercase_string("İSTANBUL"));
+    check_result("uppercase first", "Ssa|Ǆ|ǅemal|Élan", uppercase_first("ßa") + "|"
+                 + uppercase_string("ǆ") + "|" + uppercase_first("ǆemal") + "|"
+                 + uppercase_first("élan"));
+    check_result("lowercase first", "ärger|gOBLIN", lowercase_first("Ärger") + "|"
+                 + lowercase_first("GOBLIN"));
+
+    check_result("replace all", "a-b-c--", replace_all("a, b, c, , ", ", ", "-"));
+    check_result("replace all of", "a_b_c", replace_all_of("a.b;c", ".;", "_"));
+
+    // @s are taken in pairs from the left; any unknown key leaves it alone
+    const map<string, string> keys = { {"foo", "bar"}, {"x", "@y@"} };
+    check_result("replace keys", "bazbar is @y@", replace_keys("baz@foo@ is @x@", keys));
+    check_result("replace keys unknown", "@foo@ and @bar@",
+                 replace_keys("@foo@ and @bar@", keys));
+    check_result("replace keys pairing", "a@foo@b",
+                 replace_keys("a@foo@b", { {"foo@b", "!"} }));
+
+    return 0;
+}
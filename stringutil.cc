@@ -8,7 +8,6 @@
 #include "stringutil.h"
 
 #include <cwctype>
-#include <sstream>
 
 #include "libutil.h"
 #if NOT_XLATE_POC
@@ -17,6 +16,7 @@
 #include <cstdarg>
 #endif
 #include "unicode.h"
+#include "unicode-case.h"
 
 #ifndef CRAWL_HAVE_STRLCPY
 size_t strlcpy(char *dst, const char *src, size_t n)
@@ -42,35 +42,25 @@ size_t strlcpy(char *dst, const char *src, size_t n)
 #endif
 
 
+// The case functions don't depend on the locale, and ASCII letters only
+// ever map to ASCII. (Crawl breaks horribly otherwise: in Turkish, for
+// example, lowercase I is a dotless i that is not ASCII.)
 string lowercase_string(const string &s)
 {
-    string res;
-    char32_t c;
-    char buf[4];
-    for (const char *tp = s.c_str(); int len = utf8towc(&c, tp); tp += len)
-    {
-        // crawl breaks horribly if this is allowed to affect ascii chars,
-        // so override locale-specific casing for ascii. (For example, in
-        // Turkish; tr_TR.utf8 lowercase I is a dotless i that is not
-        // ascii, which breaks many things.)
-        if (isaalpha(tp[0]))
-            res.append(1, toalower(tp[0]));
-        else
-            res.append(buf, wctoutf8(buf, towlower(c)));
-    }
+    string res = s;
+    utf8_lowercase(res);
     return res;
 }
 
 string &lowercase(string &s)
 {
-    s = lowercase_string(s);
+    utf8_lowercase(s);
     return s;
 }
 
 string &uppercase(string &s)
 {
-    for (char &ch : s)
-        ch = toupper_safe(ch);
+    utf8_uppercase(s);
     return s;
 }
 
@@ -79,37 +69,17 @@ string uppercase_string(string s)
     return uppercase(s);
 }
 
-// Warning: this (and uppercase_first()) relies on no libc (glibc, BSD libc,
-// MSVC crt) supporting letters that expand or contract, like German ß (-> SS)
-// upon capitalization / lowercasing. This is mostly a fault of the API --
-// there's no way to return two characters in one code point.
-// Also, all characters must have the same length in bytes before and after
-// lowercasing, all platforms currently have this property.
-//
-// A non-hacky version would be slower for no gain other than sane code; at
-// least unless you use some more powerful API.
 string lowercase_first(string s)
 {
-    char32_t c;
-    if (!s.empty())
-    {
-        utf8towc(&c, &s[0]);
-        wctoutf8(&s[0], towlower(c));
-    }
+    utf8_lowercase_first(s);
     return s;
 }
 
+// Title case, so "ß" becomes "Ss". (Still incorrect for Dutch "ij", which
+// is two letters as far as Unicode is concerned.)
 string uppercase_first(string s)
 {
-    // Incorrect due to those pesky Dutch having "ij" as a single letter (wtf?).
-    // Too bad, there's no standard function to handle that character, and I
-    // don't care enough.
-    char32_t c;
-    if (!s.empty())
-    {
-        utf8towc(&c, &s[0]);
-        wctoutf8(&s[0], towupper(c));
-    }
+    utf8_titlecase_first(s);
     return s;
 }
 
@@ -296,15 +266,23 @@ string replace_all(string s, const string &find, const string &repl)
 {
     ASSERT(!find.empty());
     string::size_type start = 0;
-    string::size_type found;
-
-    while ((found = s.find(find, start)) != string::npos)
+    string::size_type found = s.find(find);
+    if (found == string::npos)
+        return s;
+
+    // copy across once rather than shuffling the tail along per match
+    string result;
+    result.reserve(s.length());
+    do
     {
-        s.replace(found, find.length(), repl);
-        start = found + repl.length();
+        result.append(s, start, found - start);
+        result += repl;
+        start = found + find.length();
     }
+    while ((found = s.find(find, start)) != string::npos);
+    result.append(s, start, string::npos);
 
-    return s;
+    return result;
 }
 
 // Replaces all occurrences of any of the characters in tofind with the
@@ -313,15 +291,22 @@ string replace_all_of(string s, const string &tofind, const string &replacement)
 {
     ASSERT(!tofind.empty());
     string::size_type start = 0;
-    string::size_type found;
+    string::size_type found = s.find_first_of(tofind);
+    if (found == string::npos)
+        return s;
 
-    while ((found = s.find_first_of(tofind, start)) != string::npos)
+    string result;
+    result.reserve(s.length());
+    do
     {
-        s.replace(found, 1, replacement);
-        start = found + replacement.length();
+        result.append(s, start, found - start);
+        result += replacement;
+        start = found + 1;
     }
+    while ((found = s.find_first_of(tofind, start)) != string::npos);
+    result.append(s, start, string::npos);
 
-    return s;
+    return result;
 }
 
 // Capitalise phrases encased in @CAPS@ ... @NOCAPS@. If @NOCAPS@ is
@@ -362,10 +347,10 @@ string maybe_capitalise_substring(string s)
 string replace_keys(const string &text, const map<string, string>& replacements)
 {
     string::size_type at = 0, last = 0;
-    ostringstream res;
+    string res;
     while ((at = text.find('@', last)) != string::npos)
     {
-        res << text.substr(last, at - last);
+        res.append(text, last, at - last);
         const string::size_type end = text.find('@', at + 1);
         if (end == string::npos)
             break;
@@ -376,15 +361,15 @@ string replace_keys(const string &text, const map<string, string>& replacements)
         if (!value)
             return text;
 
-        res << *value;
+        res += *value;
 
         last = end + 1;
     }
     if (!last)
         return text;
 
-    res << text.substr(last);
-    return res.str();
+    res.append(text, last, string::npos);
+    return res;
 }
 
 #if NOT_XLATE_POC
@@ -444,37 +429,78 @@ string trimmed_string(string s)
     return s;
 }
 
-static void add_segment(vector<string> &segs, string s, bool trim,
-                        bool accept_empty)
+string_view trimmed_view(string_view s)
 {
-    if (trim && !s.empty())
-        trim_string(s);
-
-    if (accept_empty || !s.empty())
-        segs.push_back(s);
+    const string_view::size_type first = s.find_first_not_of(" \t\n\r");
+    if (first == string_view::npos)
+        return s.substr(s.length());
+    return s.substr(first, s.find_last_not_of(" \t\n\r") - first + 1);
 }
 
-vector<string> split_string(const string &sep, string s, bool trim_segments,
-                            bool accept_empty_segments, int nsplits)
+split_view::iterator::iterator(const split_view &view)
+    : owner(&view), rest(view.str), splits_left(view.nsplits), done(false)
 {
-    vector<string> segments;
-    int separator_length = sep.length();
+    advance();
+}
 
-    string::size_type pos;
-    while (nsplits && (pos = s.find(sep)) != string::npos)
+void split_view::iterator::advance()
+{
+    while (!at_remainder)
     {
-        add_segment(segments, s.substr(0, pos),
-                    trim_segments, accept_empty_segments);
-
-        s.erase(0, pos + separator_length);
+        string_view seg;
+        string_view::size_type pos;
+        if (splits_left && !owner->sep.empty()
+            && (pos = rest.find(owner->sep)) != string_view::npos)
+        {
+            seg = rest.substr(0, pos);
+            rest.remove_prefix(pos + owner->sep.length());
+            if (splits_left > 0)
+                --splits_left;
+        }
+        else
+        {
+            // whatever is left is the last segment, unless it's empty
+            // before trimming
+            at_remainder = true;
+            if (rest.empty())
+                break;
+            seg = rest;
+            rest.remove_prefix(rest.length());
+        }
 
-        if (nsplits > 0)
-            --nsplits;
+        if (owner->trim)
+            seg = trimmed_view(seg);
+        if (owner->accept_empties || !seg.empty())
+        {
+            segment = seg;
+            return;
+        }
     }
+    done = true;
+}
 
-    if (!s.empty())
-        add_segment(segments, s, trim_segments, accept_empty_segments);
+vector<string_view> split_string_view(string_view sep, string_view s,
+                                      bool trim_segments,
+                                      bool accept_empty_segments, int nsplits)
+{
+    vector<string_view> segments;
+    for (string_view seg : split_view(s, sep, trim_segments,
+                                      accept_empty_segments, nsplits))
+    {
+        segments.push_back(seg);
+    }
+    return segments;
+}
 
+vector<string> split_string(const string &sep, string s, bool trim_segments,
+                            bool accept_empty_segments, int nsplits)
+{
+    vector<string> segments;
+    for (string_view seg : split_view(s, sep, trim_segments,
+                                      accept_empty_segments, nsplits))
+    {
+        segments.emplace_back(seg);
+    }
     return segments;
 }
 
@@ -53,6 +53,7 @@ int count_occurrences(const string &text, const string &searchfor);
 string &trim_string(string &str);
 string &trim_string_right(string &str);
 string trimmed_string(string s);
+string_view trimmed_view(string_view s);
 
 /**
  * Find the enumerator e between begin and end that satisfies pred(e) and
@@ -244,6 +245,75 @@ static inline bool ends_with(const string &s, const string &suffix)
 vector<string> split_string(const string &sep, string s, bool trim = true,
                             bool accept_empties = false, int nsplits = -1);
 
+/**
+ * The segments of split_string() as views into s, found one at a time.
+ * s must outlive the split_view.
+ *
+ *     for (string_view word : split_view(text, " "))
+ *         ...
+ */
+class split_view
+{
+public:
+    split_view(string_view s, string_view sep, bool trim = true,
+               bool accept_empties = false, int nsplits = -1)
+        : str(s), sep(sep), trim(trim), accept_empties(accept_empties),
+          nsplits(nsplits)
+    {
+    }
+
+    class iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef string_view value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const string_view *pointer;
+        typedef const string_view &reference;
+
+        iterator() = default;
+        reference operator*() const { return segment; }
+        pointer operator->() const { return &segment; }
+        iterator &operator++() { advance(); return *this; }
+        bool operator==(const iterator &other) const
+        {
+            return done == other.done
+                   && (done || rest.data() == other.rest.data());
+        }
+        bool operator!=(const iterator &other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class split_view;
+        explicit iterator(const split_view &owner);
+        void advance();
+
+        const split_view *owner = nullptr;
+        string_view rest;
+        string_view segment;
+        int splits_left = 0;
+        bool at_remainder = false;
+        bool done = true;
+    };
+
+    iterator begin() const { return iterator(*this); }
+    iterator end() const { return iterator(); }
+
+private:
+    string_view str;
+    string_view sep;
+    bool trim;
+    bool accept_empties;
+    int nsplits;
+};
+
+vector<string_view> split_string_view(string_view sep, string_view s,
+                                      bool trim = true,
+                                      bool accept_empties = false,
+                                      int nsplits = -1);
+
 // time
 
 string make_time_string(time_t abs_time, bool terse = false);
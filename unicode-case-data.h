@@ -0,0 +1,635 @@
+// Generated by scripts/gen-case-tables.py from Unicode 14.0.0.
+// Don't edit; rerun the script instead.
+// (ASCII is handled separately, so starts at U+0080)
+
+static const case_range lower_ranges[] =
+{
+    { 0x00c0, 23, 1, 32 },
+    { 0x00d8, 7, 1, 32 },
+    { 0x0100, 24, 2, 1 },
+    { 0x0132, 3, 2, 1 },
+    { 0x0139, 8, 2, 1 },
+    { 0x014a, 23, 2, 1 },
+    { 0x0178, 1, 1, -121 },
+    { 0x0179, 3, 2, 1 },
+    { 0x0181, 1, 1, 210 },
+    { 0x0182, 2, 2, 1 },
+    { 0x0186, 1, 1, 206 },
+    { 0x0187, 1, 1, 1 },
+    { 0x0189, 2, 1, 205 },
+    { 0x018b, 1, 1, 1 },
+    { 0x018e, 1, 1, 79 },
+    { 0x018f, 1, 1, 202 },
+    { 0x0190, 1, 1, 203 },
+    { 0x0191, 1, 1, 1 },
+    { 0x0193, 1, 1, 205 },
+    { 0x0194, 1, 1, 207 },
+    { 0x0196, 1, 1, 211 },
+    { 0x0197, 1, 1, 209 },
+    { 0x0198, 1, 1, 1 },
+    { 0x019c, 1, 1, 211 },
+    { 0x019d, 1, 1, 213 },
+    { 0x019f, 1, 1, 214 },
+    { 0x01a0, 3, 2, 1 },
+    { 0x01a6, 1, 1, 218 },
+    { 0x01a7, 1, 1, 1 },
+    { 0x01a9, 1, 1, 218 },
+    { 0x01ac, 1, 1, 1 },
+    { 0x01ae, 1, 1, 218 },
+    { 0x01af, 1, 1, 1 },
+    { 0x01b1, 2, 1, 217 },
+    { 0x01b3, 2, 2, 1 },
+    { 0x01b7, 1, 1, 219 },
+    { 0x01b8, 1, 1, 1 },
+    { 0x01bc, 1, 1, 1 },
+    { 0x01c4, 1, 1, 2 },
+    { 0x01c5, 1, 1, 1 },
+    { 0x01c7, 1, 1, 2 },
+    { 0x01c8, 1, 1, 1 },
+    { 0x01ca, 1, 1, 2 },
+    { 0x01cb, 9, 2, 1 },
+    { 0x01de, 9, 2, 1 },
+    { 0x01f1, 1, 1, 2 },
+    { 0x01f2, 2, 2, 1 },
+    { 0x01f6, 1, 1, -97 },
+    { 0x01f7, 1, 1, -56 },
+    { 0x01f8, 20, 2, 1 },
+    { 0x0220, 1, 1, -130 },
+    { 0x0222, 9, 2, 1 },
+    { 0x023a, 1, 1, 10795 },
+    { 0x023b, 1, 1, 1 },
+    { 0x023d, 1, 1, -163 },
+    { 0x023e, 1, 1, 10792 },
+    { 0x0241, 1, 1, 1 },
+    { 0x0243, 1, 1, -195 },
+    { 0x0244, 1, 1, 69 },
+    { 0x0245, 1, 1, 71 },
+    { 0x0246, 5, 2, 1 },
+    { 0x0370, 2, 2, 1 },
+    { 0x0376, 1, 1, 1 },
+    { 0x037f, 1, 1, 116 },
+    { 0x0386, 1, 1, 38 },
+    { 0x0388, 3, 1, 37 },
+    { 0x038c, 1, 1, 64 },
+    { 0x038e, 2, 1, 63 },
+    { 0x0391, 17, 1, 32 },
+    { 0x03a3, 9, 1, 32 },
+    { 0x03cf, 1, 1, 8 },
+    { 0x03d8, 12, 2, 1 },
+    { 0x03f4, 1, 1, -60 },
+    { 0x03f7, 1, 1, 1 },
+    { 0x03f9, 1, 1, -7 },
+    { 0x03fa, 1, 1, 1 },
+    { 0x03fd, 3, 1, -130 },
+    { 0x0400, 16, 1, 80 },
+    { 0x0410, 32, 1, 32 },
+    { 0x0460, 17, 2, 1 },
+    { 0x048a, 27, 2, 1 },
+    { 0x04c0, 1, 1, 15 },
+    { 0x04c1, 7, 2, 1 },
+    { 0x04d0, 48, 2, 1 },
+    { 0x0531, 38, 1, 48 },
+    { 0x10a0, 38, 1, 7264 },
+    { 0x10c7, 1, 1, 7264 },
+    { 0x10cd, 1, 1, 7264 },
+    { 0x13a0, 80, 1, 38864 },
+    { 0x13f0, 6, 1, 8 },
+    { 0x1c90, 43, 1, -3008 },
+    { 0x1cbd, 3, 1, -3008 },
+    { 0x1e00, 75, 2, 1 },
+    { 0x1e9e, 1, 1, -7615 },
+    { 0x1ea0, 48, 2, 1 },
+    { 0x1f08, 8, 1, -8 },
+    { 0x1f18, 6, 1, -8 },
+    { 0x1f28, 8, 1, -8 },
+    { 0x1f38, 8, 1, -8 },
+    { 0x1f48, 6, 1, -8 },
+    { 0x1f59, 4, 2, -8 },
+    { 0x1f68, 8, 1, -8 },
+    { 0x1f88, 8, 1, -8 },
+    { 0x1f98, 8, 1, -8 },
+    { 0x1fa8, 8, 1, -8 },
+    { 0x1fb8, 2, 1, -8 },
+    { 0x1fba, 2, 1, -74 },
+    { 0x1fbc, 1, 1, -9 },
+    { 0x1fc8, 4, 1, -86 },
+    { 0x1fcc, 1, 1, -9 },
+    { 0x1fd8, 2, 1, -8 },
+    { 0x1fda, 2, 1, -100 },
+    { 0x1fe8, 2, 1, -8 },
+    { 0x1fea, 2, 1, -112 },
+    { 0x1fec, 1, 1, -7 },
+    { 0x1ff8, 2, 1, -128 },
+    { 0x1ffa, 2, 1, -126 },
+    { 0x1ffc, 1, 1, -9 },
+    { 0x2126, 1, 1, -7517 },
+    { 0x212a, 1, 1, -8383 },
+    { 0x212b, 1, 1, -8262 },
+    { 0x2132, 1, 1, 28 },
+    { 0x2160, 16, 1, 16 },
+    { 0x2183, 1, 1, 1 },
+    { 0x24b6, 26, 1, 26 },
+    { 0x2c00, 48, 1, 48 },
+    { 0x2c60, 1, 1, 1 },
+    { 0x2c62, 1, 1, -10743 },
+    { 0x2c63, 1, 1, -3814 },
+    { 0x2c64, 1, 1, -10727 },
+    { 0x2c67, 3, 2, 1 },
+    { 0x2c6d, 1, 1, -10780 },
+    { 0x2c6e, 1, 1, -10749 },
+    { 0x2c6f, 1, 1, -10783 },
+    { 0x2c70, 1, 1, -10782 },
+    { 0x2c72, 1, 1, 1 },
+    { 0x2c75, 1, 1, 1 },
+    { 0x2c7e, 2, 1, -10815 },
+    { 0x2c80, 50, 2, 1 },
+    { 0x2ceb, 2, 2, 1 },
+    { 0x2cf2, 1, 1, 1 },
+    { 0xa640, 23, 2, 1 },
+    { 0xa680, 14, 2, 1 },
+    { 0xa722, 7, 2, 1 },
+    { 0xa732, 31, 2, 1 },
+    { 0xa779, 2, 2, 1 },
+    { 0xa77d, 1, 1, -35332 },
+    { 0xa77e, 5, 2, 1 },
+    { 0xa78b, 1, 1, 1 },
+    { 0xa78d, 1, 1, -42280 },
+    { 0xa790, 2, 2, 1 },
+    { 0xa796, 10, 2, 1 },
+    { 0xa7aa, 1, 1, -42308 },
+    { 0xa7ab, 1, 1, -42319 },
+    { 0xa7ac, 1, 1, -42315 },
+    { 0xa7ad, 1, 1, -42305 },
+    { 0xa7ae, 1, 1, -42308 },
+    { 0xa7b0, 1, 1, -42258 },
+    { 0xa7b1, 1, 1, -42282 },
+    { 0xa7b2, 1, 1, -42261 },
+    { 0xa7b3, 1, 1, 928 },
+    { 0xa7b4, 8, 2, 1 },
+    { 0xa7c4, 1, 1, -48 },
+    { 0xa7c5, 1, 1, -42307 },
+    { 0xa7c6, 1, 1, -35384 },
+    { 0xa7c7, 2, 2, 1 },
+    { 0xa7d0, 1, 1, 1 },
+    { 0xa7d6, 2, 2, 1 },
+    { 0xa7f5, 1, 1, 1 },
+    { 0xff21, 26, 1, 32 },
+    { 0x10400, 40, 1, 40 },
+    { 0x104b0, 36, 1, 40 },
+    { 0x10570, 11, 1, 39 },
+    { 0x1057c, 15, 1, 39 },
+    { 0x1058c, 7, 1, 39 },
+    { 0x10594, 2, 1, 39 },
+    { 0x10c80, 51, 1, 64 },
+    { 0x118a0, 32, 1, 32 },
+    { 0x16e40, 32, 1, 32 },
+    { 0x1e900, 34, 1, 34 },
+};
+
+static const case_special lower_special[] =
+{
+    { 0x0130, "\x69\xcc\x87" }, // LATIN CAPITAL LETTER I WITH DOT ABOVE
+};
+
+static const case_range upper_ranges[] =
+{
+    { 0x00b5, 1, 1, 743 },
+    { 0x00e0, 23, 1, -32 },
+    { 0x00f8, 7, 1, -32 },
+    { 0x00ff, 1, 1, 121 },
+    { 0x0101, 24, 2, -1 },
+    { 0x0131, 1, 1, -232 },
+    { 0x0133, 3, 2, -1 },
+    { 0x013a, 8, 2, -1 },
+    { 0x014b, 23, 2, -1 },
+    { 0x017a, 3, 2, -1 },
+    { 0x017f, 1, 1, -300 },
+    { 0x0180, 1, 1, 195 },
+    { 0x0183, 2, 2, -1 },
+    { 0x0188, 1, 1, -1 },
+    { 0x018c, 1, 1, -1 },
+    { 0x0192, 1, 1, -1 },
+    { 0x0195, 1, 1, 97 },
+    { 0x0199, 1, 1, -1 },
+    { 0x019a, 1, 1, 163 },
+    { 0x019e, 1, 1, 130 },
+    { 0x01a1, 3, 2, -1 },
+    { 0x01a8, 1, 1, -1 },
+    { 0x01ad, 1, 1, -1 },
+    { 0x01b0, 1, 1, -1 },
+    { 0x01b4, 2, 2, -1 },
+    { 0x01b9, 1, 1, -1 },
+    { 0x01bd, 1, 1, -1 },
+    { 0x01bf, 1, 1, 56 },
+    { 0x01c5, 1, 1, -1 },
+    { 0x01c6, 1, 1, -2 },
+    { 0x01c8, 1, 1, -1 },
+    { 0x01c9, 1, 1, -2 },
+    { 0x01cb, 1, 1, -1 },
+    { 0x01cc, 1, 1, -2 },
+    { 0x01ce, 8, 2, -1 },
+    { 0x01dd, 1, 1, -79 },
+    { 0x01df, 9, 2, -1 },
+    { 0x01f2, 1, 1, -1 },
+    { 0x01f3, 1, 1, -2 },
+    { 0x01f5, 1, 1, -1 },
+    { 0x01f9, 20, 2, -1 },
+    { 0x0223, 9, 2, -1 },
+    { 0x023c, 1, 1, -1 },
+    { 0x023f, 2, 1, 10815 },
+    { 0x0242, 1, 1, -1 },
+    { 0x0247, 5, 2, -1 },
+    { 0x0250, 1, 1, 10783 },
+    { 0x0251, 1, 1, 10780 },
+    { 0x0252, 1, 1, 10782 },
+    { 0x0253, 1, 1, -210 },
+    { 0x0254, 1, 1, -206 },
+    { 0x0256, 2, 1, -205 },
+    { 0x0259, 1, 1, -202 },
+    { 0x025b, 1, 1, -203 },
+    { 0x025c, 1, 1, 42319 },
+    { 0x0260, 1, 1, -205 },
+    { 0x0261, 1, 1, 42315 },
+    { 0x0263, 1, 1, -207 },
+    { 0x0265, 1, 1, 42280 },
+    { 0x0266, 1, 1, 42308 },
+    { 0x0268, 1, 1, -209 },
+    { 0x0269, 1, 1, -211 },
+    { 0x026a, 1, 1, 42308 },
+    { 0x026b, 1, 1, 10743 },
+    { 0x026c, 1, 1, 42305 },
+    { 0x026f, 1, 1, -211 },
+    { 0x0271, 1, 1, 10749 },
+    { 0x0272, 1, 1, -213 },
+    { 0x0275, 1, 1, -214 },
+    { 0x027d, 1, 1, 10727 },
+    { 0x0280, 1, 1, -218 },
+    { 0x0282, 1, 1, 42307 },
+    { 0x0283, 1, 1, -218 },
+    { 0x0287, 1, 1, 42282 },
+    { 0x0288, 1, 1, -218 },
+    { 0x0289, 1, 1, -69 },
+    { 0x028a, 2, 1, -217 },
+    { 0x028c, 1, 1, -71 },
+    { 0x0292, 1, 1, -219 },
+    { 0x029d, 1, 1, 42261 },
+    { 0x029e, 1, 1, 42258 },
+    { 0x0345, 1, 1, 84 },
+    { 0x0371, 2, 2, -1 },
+    { 0x0377, 1, 1, -1 },
+    { 0x037b, 3, 1, 130 },
+    { 0x03ac, 1, 1, -38 },
+    { 0x03ad, 3, 1, -37 },
+    { 0x03b1, 17, 1, -32 },
+    { 0x03c2, 1, 1, -31 },
+    { 0x03c3, 9, 1, -32 },
+    { 0x03cc, 1, 1, -64 },
+    { 0x03cd, 2, 1, -63 },
+    { 0x03d0, 1, 1, -62 },
+    { 0x03d1, 1, 1, -57 },
+    { 0x03d5, 1, 1, -47 },
+    { 0x03d6, 1, 1, -54 },
+    { 0x03d7, 1, 1, -8 },
+    { 0x03d9, 12, 2, -1 },
+    { 0x03f0, 1, 1, -86 },
+    { 0x03f1, 1, 1, -80 },
+    { 0x03f2, 1, 1, 7 },
+    { 0x03f3, 1, 1, -116 },
+    { 0x03f5, 1, 1, -96 },
+    { 0x03f8, 1, 1, -1 },
+    { 0x03fb, 1, 1, -1 },
+    { 0x0430, 32, 1, -32 },
+    { 0x0450, 16, 1, -80 },
+    { 0x0461, 17, 2, -1 },
+    { 0x048b, 27, 2, -1 },
+    { 0x04c2, 7, 2, -1 },
+    { 0x04cf, 1, 1, -15 },
+    { 0x04d1, 48, 2, -1 },
+    { 0x0561, 38, 1, -48 },
+    { 0x10d0, 43, 1, 3008 },
+    { 0x10fd, 3, 1, 3008 },
+    { 0x13f8, 6, 1, -8 },
+    { 0x1c80, 1, 1, -6254 },
+    { 0x1c81, 1, 1, -6253 },
+    { 0x1c82, 1, 1, -6244 },
+    { 0x1c83, 2, 1, -6242 },
+    { 0x1c85, 1, 1, -6243 },
+    { 0x1c86, 1, 1, -6236 },
+    { 0x1c87, 1, 1, -6181 },
+    { 0x1c88, 1, 1, 35266 },
+    { 0x1d79, 1, 1, 35332 },
+    { 0x1d7d, 1, 1, 3814 },
+    { 0x1d8e, 1, 1, 35384 },
+    { 0x1e01, 75, 2, -1 },
+    { 0x1e9b, 1, 1, -59 },
+    { 0x1ea1, 48, 2, -1 },
+    { 0x1f00, 8, 1, 8 },
+    { 0x1f10, 6, 1, 8 },
+    { 0x1f20, 8, 1, 8 },
+    { 0x1f30, 8, 1, 8 },
+    { 0x1f40, 6, 1, 8 },
+    { 0x1f51, 4, 2, 8 },
+    { 0x1f60, 8, 1, 8 },
+    { 0x1f70, 2, 1, 74 },
+    { 0x1f72, 4, 1, 86 },
+    { 0x1f76, 2, 1, 100 },
+    { 0x1f78, 2, 1, 128 },
+    { 0x1f7a, 2, 1, 112 },
+    { 0x1f7c, 2, 1, 126 },
+    { 0x1fb0, 2, 1, 8 },
+    { 0x1fbe, 1, 1, -7205 },
+    { 0x1fd0, 2, 1, 8 },
+    { 0x1fe0, 2, 1, 8 },
+    { 0x1fe5, 1, 1, 7 },
+    { 0x214e, 1, 1, -28 },
+    { 0x2170, 16, 1, -16 },
+    { 0x2184, 1, 1, -1 },
+    { 0x24d0, 26, 1, -26 },
+    { 0x2c30, 48, 1, -48 },
+    { 0x2c61, 1, 1, -1 },
+    { 0x2c65, 1, 1, -10795 },
+    { 0x2c66, 1, 1, -10792 },
+    { 0x2c68, 3, 2, -1 },
+    { 0x2c73, 1, 1, -1 },
+    { 0x2c76, 1, 1, -1 },
+    { 0x2c81, 50, 2, -1 },
+    { 0x2cec, 2, 2, -1 },
+    { 0x2cf3, 1, 1, -1 },
+    { 0x2d00, 38, 1, -7264 },
+    { 0x2d27, 1, 1, -7264 },
+    { 0x2d2d, 1, 1, -7264 },
+    { 0xa641, 23, 2, -1 },
+    { 0xa681, 14, 2, -1 },
+    { 0xa723, 7, 2, -1 },
+    { 0xa733, 31, 2, -1 },
+    { 0xa77a, 2, 2, -1 },
+    { 0xa77f, 5, 2, -1 },
+    { 0xa78c, 1, 1, -1 },
+    { 0xa791, 2, 2, -1 },
+    { 0xa794, 1, 1, 48 },
+    { 0xa797, 10, 2, -1 },
+    { 0xa7b5, 8, 2, -1 },
+    { 0xa7c8, 2, 2, -1 },
+    { 0xa7d1, 1, 1, -1 },
+    { 0xa7d7, 2, 2, -1 },
+    { 0xa7f6, 1, 1, -1 },
+    { 0xab53, 1, 1, -928 },
+    { 0xab70, 80, 1, -38864 },
+    { 0xff41, 26, 1, -32 },
+    { 0x10428, 40, 1, -40 },
+    { 0x104d8, 36, 1, -40 },
+    { 0x10597, 11, 1, -39 },
+    { 0x105a3, 15, 1, -39 },
+    { 0x105b3, 7, 1, -39 },
+    { 0x105bb, 2, 1, -39 },
+    { 0x10cc0, 51, 1, -64 },
+    { 0x118c0, 32, 1, -32 },
+    { 0x16e60, 32, 1, -32 },
+    { 0x1e922, 34, 1, -34 },
+};
+
+static const case_special upper_special[] =
+{
+    { 0x00df, "\x53\x53" }, // LATIN SMALL LETTER SHARP S
+    { 0x0149, "\xca\xbc\x4e" }, // LATIN SMALL LETTER N PRECEDED BY APOSTROPHE
+    { 0x01f0, "\x4a\xcc\x8c" }, // LATIN SMALL LETTER J WITH CARON
+    { 0x0390, "\xce\x99\xcc\x88\xcc\x81" }, // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS
+    { 0x03b0, "\xce\xa5\xcc\x88\xcc\x81" }, // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS
+    { 0x0587, "\xd4\xb5\xd5\x92" }, // ARMENIAN SMALL LIGATURE ECH YIWN
+    { 0x1e96, "\x48\xcc\xb1" }, // LATIN SMALL LETTER H WITH LINE BELOW
+    { 0x1e97, "\x54\xcc\x88" }, // LATIN SMALL LETTER T WITH DIAERESIS
+    { 0x1e98, "\x57\xcc\x8a" }, // LATIN SMALL LETTER W WITH RING ABOVE
+    { 0x1e99, "\x59\xcc\x8a" }, // LATIN SMALL LETTER Y WITH RING ABOVE
+    { 0x1e9a, "\x41\xca\xbe" }, // LATIN SMALL LETTER A WITH RIGHT HALF RING
+    { 0x1f50, "\xce\xa5\xcc\x93" }, // GREEK SMALL LETTER UPSILON WITH PSILI
+    { 0x1f52, "\xce\xa5\xcc\x93\xcc\x80" }, // GREEK SMALL LETTER UPSILON WITH PSILI AND VARIA
+    { 0x1f54, "\xce\xa5\xcc\x93\xcc\x81" }, // GREEK SMALL LETTER UPSILON WITH PSILI AND OXIA
+    { 0x1f56, "\xce\xa5\xcc\x93\xcd\x82" }, // GREEK SMALL LETTER UPSILON WITH PSILI AND PERISPOMENI
+    { 0x1f80, "\xe1\xbc\x88\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH PSILI AND YPOGEGRAMMENI
+    { 0x1f81, "\xe1\xbc\x89\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH DASIA AND YPOGEGRAMMENI
+    { 0x1f82, "\xe1\xbc\x8a\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+    { 0x1f83, "\xe1\xbc\x8b\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+    { 0x1f84, "\xe1\xbc\x8c\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+    { 0x1f85, "\xe1\xbc\x8d\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+    { 0x1f86, "\xe1\xbc\x8e\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1f87, "\xe1\xbc\x8f\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1f88, "\xe1\xbc\x88\xce\x99" }, // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PROSGEGRAMMENI
+    { 0x1f89, "\xe1\xbc\x89\xce\x99" }, // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PROSGEGRAMMENI
+    { 0x1f8a, "\xe1\xbc\x8a\xce\x99" }, // GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+    { 0x1f8b, "\xe1\xbc\x8b\xce\x99" }, // GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+    { 0x1f8c, "\xe1\xbc\x8c\xce\x99" }, // GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+    { 0x1f8d, "\xe1\xbc\x8d\xce\x99" }, // GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+    { 0x1f8e, "\xe1\xbc\x8e\xce\x99" }, // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1f8f, "\xe1\xbc\x8f\xce\x99" }, // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1f90, "\xe1\xbc\xa8\xce\x99" }, // GREEK SMALL LETTER ETA WITH PSILI AND YPOGEGRAMMENI
+    { 0x1f91, "\xe1\xbc\xa9\xce\x99" }, // GREEK SMALL LETTER ETA WITH DASIA AND YPOGEGRAMMENI
+    { 0x1f92, "\xe1\xbc\xaa\xce\x99" }, // GREEK SMALL LETTER ETA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+    { 0x1f93, "\xe1\xbc\xab\xce\x99" }, // GREEK SMALL LETTER ETA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+    { 0x1f94, "\xe1\xbc\xac\xce\x99" }, // GREEK SMALL LETTER ETA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+    { 0x1f95, "\xe1\xbc\xad\xce\x99" }, // GREEK SMALL LETTER ETA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+    { 0x1f96, "\xe1\xbc\xae\xce\x99" }, // GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1f97, "\xe1\xbc\xaf\xce\x99" }, // GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1f98, "\xe1\xbc\xa8\xce\x99" }, // GREEK CAPITAL LETTER ETA WITH PSILI AND PROSGEGRAMMENI
+    { 0x1f99, "\xe1\xbc\xa9\xce\x99" }, // GREEK CAPITAL LETTER ETA WITH DASIA AND PROSGEGRAMMENI
+    { 0x1f9a, "\xe1\xbc\xaa\xce\x99" }, // GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+    { 0x1f9b, "\xe1\xbc\xab\xce\x99" }, // GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+    { 0x1f9c, "\xe1\xbc\xac\xce\x99" }, // GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+    { 0x1f9d, "\xe1\xbc\xad\xce\x99" }, // GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+    { 0x1f9e, "\xe1\xbc\xae\xce\x99" }, // GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1f9f, "\xe1\xbc\xaf\xce\x99" }, // GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1fa0, "\xe1\xbd\xa8\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH PSILI AND YPOGEGRAMMENI
+    { 0x1fa1, "\xe1\xbd\xa9\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH DASIA AND YPOGEGRAMMENI
+    { 0x1fa2, "\xe1\xbd\xaa\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+    { 0x1fa3, "\xe1\xbd\xab\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+    { 0x1fa4, "\xe1\xbd\xac\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+    { 0x1fa5, "\xe1\xbd\xad\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+    { 0x1fa6, "\xe1\xbd\xae\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1fa7, "\xe1\xbd\xaf\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1fa8, "\xe1\xbd\xa8\xce\x99" }, // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PROSGEGRAMMENI
+    { 0x1fa9, "\xe1\xbd\xa9\xce\x99" }, // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PROSGEGRAMMENI
+    { 0x1faa, "\xe1\xbd\xaa\xce\x99" }, // GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+    { 0x1fab, "\xe1\xbd\xab\xce\x99" }, // GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+    { 0x1fac, "\xe1\xbd\xac\xce\x99" }, // GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+    { 0x1fad, "\xe1\xbd\xad\xce\x99" }, // GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+    { 0x1fae, "\xe1\xbd\xae\xce\x99" }, // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1faf, "\xe1\xbd\xaf\xce\x99" }, // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1fb2, "\xe1\xbe\xba\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI
+    { 0x1fb3, "\xce\x91\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH YPOGEGRAMMENI
+    { 0x1fb4, "\xce\x86\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI
+    { 0x1fb6, "\xce\x91\xcd\x82" }, // GREEK SMALL LETTER ALPHA WITH PERISPOMENI
+    { 0x1fb7, "\xce\x91\xcd\x82\xce\x99" }, // GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1fbc, "\xce\x91\xce\x99" }, // GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI
+    { 0x1fc2, "\xe1\xbf\x8a\xce\x99" }, // GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI
+    { 0x1fc3, "\xce\x97\xce\x99" }, // GREEK SMALL LETTER ETA WITH YPOGEGRAMMENI
+    { 0x1fc4, "\xce\x89\xce\x99" }, // GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI
+    { 0x1fc6, "\xce\x97\xcd\x82" }, // GREEK SMALL LETTER ETA WITH PERISPOMENI
+    { 0x1fc7, "\xce\x97\xcd\x82\xce\x99" }, // GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1fcc, "\xce\x97\xce\x99" }, // GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI
+    { 0x1fd2, "\xce\x99\xcc\x88\xcc\x80" }, // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND VARIA
+    { 0x1fd3, "\xce\x99\xcc\x88\xcc\x81" }, // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND OXIA
+    { 0x1fd6, "\xce\x99\xcd\x82" }, // GREEK SMALL LETTER IOTA WITH PERISPOMENI
+    { 0x1fd7, "\xce\x99\xcc\x88\xcd\x82" }, // GREEK SMALL LETTER IOTA WITH DIALYTIKA AND PERISPOMENI
+    { 0x1fe2, "\xce\xa5\xcc\x88\xcc\x80" }, // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND VARIA
+    { 0x1fe3, "\xce\xa5\xcc\x88\xcc\x81" }, // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND OXIA
+    { 0x1fe4, "\xce\xa1\xcc\x93" }, // GREEK SMALL LETTER RHO WITH PSILI
+    { 0x1fe6, "\xce\xa5\xcd\x82" }, // GREEK SMALL LETTER UPSILON WITH PERISPOMENI
+    { 0x1fe7, "\xce\xa5\xcc\x88\xcd\x82" }, // GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND PERISPOMENI
+    { 0x1ff2, "\xe1\xbf\xba\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI
+    { 0x1ff3, "\xce\xa9\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH YPOGEGRAMMENI
+    { 0x1ff4, "\xce\x8f\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI
+    { 0x1ff6, "\xce\xa9\xcd\x82" }, // GREEK SMALL LETTER OMEGA WITH PERISPOMENI
+    { 0x1ff7, "\xce\xa9\xcd\x82\xce\x99" }, // GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1ffc, "\xce\xa9\xce\x99" }, // GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI
+    { 0xfb00, "\x46\x46" }, // LATIN SMALL LIGATURE FF
+    { 0xfb01, "\x46\x49" }, // LATIN SMALL LIGATURE FI
+    { 0xfb02, "\x46\x4c" }, // LATIN SMALL LIGATURE FL
+    { 0xfb03, "\x46\x46\x49" }, // LATIN SMALL LIGATURE FFI
+    { 0xfb04, "\x46\x46\x4c" }, // LATIN SMALL LIGATURE FFL
+    { 0xfb05, "\x53\x54" }, // LATIN SMALL LIGATURE LONG S T
+    { 0xfb06, "\x53\x54" }, // LATIN SMALL LIGATURE ST
+    { 0xfb13, "\xd5\x84\xd5\x86" }, // ARMENIAN SMALL LIGATURE MEN NOW
+    { 0xfb14, "\xd5\x84\xd4\xb5" }, // ARMENIAN SMALL LIGATURE MEN ECH
+    { 0xfb15, "\xd5\x84\xd4\xbb" }, // ARMENIAN SMALL LIGATURE MEN INI
+    { 0xfb16, "\xd5\x8e\xd5\x86" }, // ARMENIAN SMALL LIGATURE VEW NOW
+    { 0xfb17, "\xd5\x84\xd4\xbd" }, // ARMENIAN SMALL LIGATURE MEN XEH
+};
+
+static const case_special title_special[] =
+{
+    { 0x00df, "\x53\x73" }, // LATIN SMALL LETTER SHARP S
+    { 0x01c4, "\xc7\x85" }, // LATIN CAPITAL LETTER DZ WITH CARON
+    { 0x01c5, "\xc7\x85" }, // LATIN CAPITAL LETTER D WITH SMALL LETTER Z WITH CARON
+    { 0x01c6, "\xc7\x85" }, // LATIN SMALL LETTER DZ WITH CARON
+    { 0x01c7, "\xc7\x88" }, // LATIN CAPITAL LETTER LJ
+    { 0x01c8, "\xc7\x88" }, // LATIN CAPITAL LETTER L WITH SMALL LETTER J
+    { 0x01c9, "\xc7\x88" }, // LATIN SMALL LETTER LJ
+    { 0x01ca, "\xc7\x8b" }, // LATIN CAPITAL LETTER NJ
+    { 0x01cb, "\xc7\x8b" }, // LATIN CAPITAL LETTER N WITH SMALL LETTER J
+    { 0x01cc, "\xc7\x8b" }, // LATIN SMALL LETTER NJ
+    { 0x01f1, "\xc7\xb2" }, // LATIN CAPITAL LETTER DZ
+    { 0x01f2, "\xc7\xb2" }, // LATIN CAPITAL LETTER D WITH SMALL LETTER Z
+    { 0x01f3, "\xc7\xb2" }, // LATIN SMALL LETTER DZ
+    { 0x0587, "\xd4\xb5\xd6\x82" }, // ARMENIAN SMALL LIGATURE ECH YIWN
+    { 0x10d0, "\xe1\x83\x90" }, // GEORGIAN LETTER AN
+    { 0x10d1, "\xe1\x83\x91" }, // GEORGIAN LETTER BAN
+    { 0x10d2, "\xe1\x83\x92" }, // GEORGIAN LETTER GAN
+    { 0x10d3, "\xe1\x83\x93" }, // GEORGIAN LETTER DON
+    { 0x10d4, "\xe1\x83\x94" }, // GEORGIAN LETTER EN
+    { 0x10d5, "\xe1\x83\x95" }, // GEORGIAN LETTER VIN
+    { 0x10d6, "\xe1\x83\x96" }, // GEORGIAN LETTER ZEN
+    { 0x10d7, "\xe1\x83\x97" }, // GEORGIAN LETTER TAN
+    { 0x10d8, "\xe1\x83\x98" }, // GEORGIAN LETTER IN
+    { 0x10d9, "\xe1\x83\x99" }, // GEORGIAN LETTER KAN
+    { 0x10da, "\xe1\x83\x9a" }, // GEORGIAN LETTER LAS
+    { 0x10db, "\xe1\x83\x9b" }, // GEORGIAN LETTER MAN
+    { 0x10dc, "\xe1\x83\x9c" }, // GEORGIAN LETTER NAR
+    { 0x10dd, "\xe1\x83\x9d" }, // GEORGIAN LETTER ON
+    { 0x10de, "\xe1\x83\x9e" }, // GEORGIAN LETTER PAR
+    { 0x10df, "\xe1\x83\x9f" }, // GEORGIAN LETTER ZHAR
+    { 0x10e0, "\xe1\x83\xa0" }, // GEORGIAN LETTER RAE
+    { 0x10e1, "\xe1\x83\xa1" }, // GEORGIAN LETTER SAN
+    { 0x10e2, "\xe1\x83\xa2" }, // GEORGIAN LETTER TAR
+    { 0x10e3, "\xe1\x83\xa3" }, // GEORGIAN LETTER UN
+    { 0x10e4, "\xe1\x83\xa4" }, // GEORGIAN LETTER PHAR
+    { 0x10e5, "\xe1\x83\xa5" }, // GEORGIAN LETTER KHAR
+    { 0x10e6, "\xe1\x83\xa6" }, // GEORGIAN LETTER GHAN
+    { 0x10e7, "\xe1\x83\xa7" }, // GEORGIAN LETTER QAR
+    { 0x10e8, "\xe1\x83\xa8" }, // GEORGIAN LETTER SHIN
+    { 0x10e9, "\xe1\x83\xa9" }, // GEORGIAN LETTER CHIN
+    { 0x10ea, "\xe1\x83\xaa" }, // GEORGIAN LETTER CAN
+    { 0x10eb, "\xe1\x83\xab" }, // GEORGIAN LETTER JIL
+    { 0x10ec, "\xe1\x83\xac" }, // GEORGIAN LETTER CIL
+    { 0x10ed, "\xe1\x83\xad" }, // GEORGIAN LETTER CHAR
+    { 0x10ee, "\xe1\x83\xae" }, // GEORGIAN LETTER XAN
+    { 0x10ef, "\xe1\x83\xaf" }, // GEORGIAN LETTER JHAN
+    { 0x10f0, "\xe1\x83\xb0" }, // GEORGIAN LETTER HAE
+    { 0x10f1, "\xe1\x83\xb1" }, // GEORGIAN LETTER HE
+    { 0x10f2, "\xe1\x83\xb2" }, // GEORGIAN LETTER HIE
+    { 0x10f3, "\xe1\x83\xb3" }, // GEORGIAN LETTER WE
+    { 0x10f4, "\xe1\x83\xb4" }, // GEORGIAN LETTER HAR
+    { 0x10f5, "\xe1\x83\xb5" }, // GEORGIAN LETTER HOE
+    { 0x10f6, "\xe1\x83\xb6" }, // GEORGIAN LETTER FI
+    { 0x10f7, "\xe1\x83\xb7" }, // GEORGIAN LETTER YN
+    { 0x10f8, "\xe1\x83\xb8" }, // GEORGIAN LETTER ELIFI
+    { 0x10f9, "\xe1\x83\xb9" }, // GEORGIAN LETTER TURNED GAN
+    { 0x10fa, "\xe1\x83\xba" }, // GEORGIAN LETTER AIN
+    { 0x10fd, "\xe1\x83\xbd" }, // GEORGIAN LETTER AEN
+    { 0x10fe, "\xe1\x83\xbe" }, // GEORGIAN LETTER HARD SIGN
+    { 0x10ff, "\xe1\x83\xbf" }, // GEORGIAN LETTER LABIAL SIGN
+    { 0x1f80, "\xe1\xbe\x88" }, // GREEK SMALL LETTER ALPHA WITH PSILI AND YPOGEGRAMMENI
+    { 0x1f81, "\xe1\xbe\x89" }, // GREEK SMALL LETTER ALPHA WITH DASIA AND YPOGEGRAMMENI
+    { 0x1f82, "\xe1\xbe\x8a" }, // GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+    { 0x1f83, "\xe1\xbe\x8b" }, // GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+    { 0x1f84, "\xe1\xbe\x8c" }, // GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+    { 0x1f85, "\xe1\xbe\x8d" }, // GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+    { 0x1f86, "\xe1\xbe\x8e" }, // GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1f87, "\xe1\xbe\x8f" }, // GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1f88, "\xe1\xbe\x88" }, // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PROSGEGRAMMENI
+    { 0x1f89, "\xe1\xbe\x89" }, // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PROSGEGRAMMENI
+    { 0x1f8a, "\xe1\xbe\x8a" }, // GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+    { 0x1f8b, "\xe1\xbe\x8b" }, // GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+    { 0x1f8c, "\xe1\xbe\x8c" }, // GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+    { 0x1f8d, "\xe1\xbe\x8d" }, // GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+    { 0x1f8e, "\xe1\xbe\x8e" }, // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1f8f, "\xe1\xbe\x8f" }, // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1f90, "\xe1\xbe\x98" }, // GREEK SMALL LETTER ETA WITH PSILI AND YPOGEGRAMMENI
+    { 0x1f91, "\xe1\xbe\x99" }, // GREEK SMALL LETTER ETA WITH DASIA AND YPOGEGRAMMENI
+    { 0x1f92, "\xe1\xbe\x9a" }, // GREEK SMALL LETTER ETA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+    { 0x1f93, "\xe1\xbe\x9b" }, // GREEK SMALL LETTER ETA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+    { 0x1f94, "\xe1\xbe\x9c" }, // GREEK SMALL LETTER ETA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+    { 0x1f95, "\xe1\xbe\x9d" }, // GREEK SMALL LETTER ETA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+    { 0x1f96, "\xe1\xbe\x9e" }, // GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1f97, "\xe1\xbe\x9f" }, // GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1f98, "\xe1\xbe\x98" }, // GREEK CAPITAL LETTER ETA WITH PSILI AND PROSGEGRAMMENI
+    { 0x1f99, "\xe1\xbe\x99" }, // GREEK CAPITAL LETTER ETA WITH DASIA AND PROSGEGRAMMENI
+    { 0x1f9a, "\xe1\xbe\x9a" }, // GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+    { 0x1f9b, "\xe1\xbe\x9b" }, // GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+    { 0x1f9c, "\xe1\xbe\x9c" }, // GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+    { 0x1f9d, "\xe1\xbe\x9d" }, // GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+    { 0x1f9e, "\xe1\xbe\x9e" }, // GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1f9f, "\xe1\xbe\x9f" }, // GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1fa0, "\xe1\xbe\xa8" }, // GREEK SMALL LETTER OMEGA WITH PSILI AND YPOGEGRAMMENI
+    { 0x1fa1, "\xe1\xbe\xa9" }, // GREEK SMALL LETTER OMEGA WITH DASIA AND YPOGEGRAMMENI
+    { 0x1fa2, "\xe1\xbe\xaa" }, // GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA AND YPOGEGRAMMENI
+    { 0x1fa3, "\xe1\xbe\xab" }, // GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA AND YPOGEGRAMMENI
+    { 0x1fa4, "\xe1\xbe\xac" }, // GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA AND YPOGEGRAMMENI
+    { 0x1fa5, "\xe1\xbe\xad" }, // GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA AND YPOGEGRAMMENI
+    { 0x1fa6, "\xe1\xbe\xae" }, // GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1fa7, "\xe1\xbe\xaf" }, // GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1fa8, "\xe1\xbe\xa8" }, // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PROSGEGRAMMENI
+    { 0x1fa9, "\xe1\xbe\xa9" }, // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PROSGEGRAMMENI
+    { 0x1faa, "\xe1\xbe\xaa" }, // GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA AND PROSGEGRAMMENI
+    { 0x1fab, "\xe1\xbe\xab" }, // GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA AND PROSGEGRAMMENI
+    { 0x1fac, "\xe1\xbe\xac" }, // GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA AND PROSGEGRAMMENI
+    { 0x1fad, "\xe1\xbe\xad" }, // GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA AND PROSGEGRAMMENI
+    { 0x1fae, "\xe1\xbe\xae" }, // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1faf, "\xe1\xbe\xaf" }, // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
+    { 0x1fb2, "\xe1\xbe\xba\xcd\x85" }, // GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI
+    { 0x1fb3, "\xe1\xbe\xbc" }, // GREEK SMALL LETTER ALPHA WITH YPOGEGRAMMENI
+    { 0x1fb4, "\xce\x86\xcd\x85" }, // GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI
+    { 0x1fb7, "\xce\x91\xcd\x82\xcd\x85" }, // GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1fbc, "\xe1\xbe\xbc" }, // GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI
+    { 0x1fc2, "\xe1\xbf\x8a\xcd\x85" }, // GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI
+    { 0x1fc3, "\xe1\xbf\x8c" }, // GREEK SMALL LETTER ETA WITH YPOGEGRAMMENI
+    { 0x1fc4, "\xce\x89\xcd\x85" }, // GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI
+    { 0x1fc7, "\xce\x97\xcd\x82\xcd\x85" }, // GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1fcc, "\xe1\xbf\x8c" }, // GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI
+    { 0x1ff2, "\xe1\xbf\xba\xcd\x85" }, // GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI
+    { 0x1ff3, "\xe1\xbf\xbc" }, // GREEK SMALL LETTER OMEGA WITH YPOGEGRAMMENI
+    { 0x1ff4, "\xce\x8f\xcd\x85" }, // GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI
+    { 0x1ff7, "\xce\xa9\xcd\x82\xcd\x85" }, // GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI
+    { 0x1ffc, "\xe1\xbf\xbc" }, // GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI
+    { 0xfb00, "\x46\x66" }, // LATIN SMALL LIGATURE FF
+    { 0xfb01, "\x46\x69" }, // LATIN SMALL LIGATURE FI
+    { 0xfb02, "\x46\x6c" }, // LATIN SMALL LIGATURE FL
+    { 0xfb03, "\x46\x66\x69" }, // LATIN SMALL LIGATURE FFI
+    { 0xfb04, "\x46\x66\x6c" }, // LATIN SMALL LIGATURE FFL
+    { 0xfb05, "\x53\x74" }, // LATIN SMALL LIGATURE LONG S T
+    { 0xfb06, "\x53\x74" }, // LATIN SMALL LIGATURE ST
+    { 0xfb13, "\xd5\x84\xd5\xb6" }, // ARMENIAN SMALL LIGATURE MEN NOW
+    { 0xfb14, "\xd5\x84\xd5\xa5" }, // ARMENIAN SMALL LIGATURE MEN ECH
+    { 0xfb15, "\xd5\x84\xd5\xab" }, // ARMENIAN SMALL LIGATURE MEN INI
+    { 0xfb16, "\xd5\x8e\xd5\xb6" }, // ARMENIAN SMALL LIGATURE VEW NOW
+    { 0xfb17, "\xd5\x84\xd5\xad" }, // ARMENIAN SMALL LIGATURE MEN XEH
+};
+
@@ -0,0 +1,253 @@
+/**
+ * @file
+ * @brief Unicode case mapping of UTF-8 strings, independent of the locale.
+**/
+
+#include "AppHdr.h"
+#include "unicode-case.h"
+
+#include <algorithm>
+#include <cstring>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "unicode.h"
+
+// first, first + stride, ... (count of them) map to themselves + delta
+struct case_range
+{
+    char32_t first;
+    uint16_t count;
+    uint8_t stride;
+    int32_t delta;
+};
+
+// code point which maps to a string (or, for title case, to something
+// other than its upper case)
+struct case_special
+{
+    char32_t cp;
+    const char *utf8;
+};
+
+#include "unicode-case-data.h"
+
+enum case_kind
+{
+    CASE_LOWER,
+    CASE_UPPER,
+    CASE_TITLE,
+};
+
+template <size_t N>
+static const case_special *_find_special(const case_special (&table)[N],
+                                         char32_t c)
+{
+    const case_special *found
+        = lower_bound(table, table + N, c,
+                      [](const case_special &entry, char32_t key)
+                      {
+                          return entry.cp < key;
+                      });
+    return found != table + N && found->cp == c ? found : nullptr;
+}
+
+template <size_t N>
+static char32_t _map_simple(const case_range (&ranges)[N], char32_t c)
+{
+    // last range starting at or before c
+    const case_range *range
+        = upper_bound(ranges, ranges + N, c,
+                      [](char32_t key, const case_range &entry)
+                      {
+                          return key < entry.first;
+                      });
+    if (range == ranges)
+        return c;
+    --range;
+
+    const char32_t offset = c - range->first;
+    if (offset % range->stride == 0 && offset / range->stride < range->count)
+        return c + range->delta;
+    return c;
+}
+
+// Write the mapping of non-ASCII c to buf as UTF-8, returning its length,
+// or 0 if c maps to itself.
+static int _map_char(char32_t c, case_kind kind, char *buf)
+{
+    const case_special *special = nullptr;
+    if (kind == CASE_TITLE)
+    {
+        special = _find_special(title_special, c);
+        kind = CASE_UPPER;
+    }
+    if (!special)
+    {
+        special = kind == CASE_LOWER ? _find_special(lower_special, c)
+                                     : _find_special(upper_special, c);
+    }
+    if (special)
+    {
+        const int len = strlen(special->utf8);
+        memcpy(buf, special->utf8, len);
+        return len;
+    }
+
+    const char32_t mapped = kind == CASE_LOWER ? _map_simple(lower_ranges, c)
+                                               : _map_simple(upper_ranges, c);
+    return mapped == c ? 0 : wctoutf8(buf, mapped);
+}
+
+static inline char _ascii_char_case(char c, bool upper)
+{
+    if (upper)
+        return c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c;
+    else
+        return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+}
+
+// Change the case of ASCII letters from p, in place, up to the first
+// non-ASCII byte or end. Returns where it stopped.
+static char *_ascii_case(char *p, char *end, bool upper)
+{
+#ifdef __SSE2__
+    // 16 bytes at a time: c is a letter to change if c - 'A' (or 'a') is
+    // unsigned < 26, i.e. shifted down by 128 it's signed < -128 + 26
+    const __m128i shift = _mm_set1_epi8(upper ? 128 - 'a' : 128 - 'A');
+    const __m128i limit = _mm_set1_epi8(-128 + 26);
+    const __m128i flip = _mm_set1_epi8(0x20);
+    for (; end - p >= 16; p += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i*>(p));
+        if (_mm_movemask_epi8(v))
+            break;
+        const __m128i letters = _mm_cmplt_epi8(_mm_add_epi8(v, shift), limit);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p),
+                         _mm_xor_si128(v, _mm_and_si128(letters, flip)));
+    }
+#endif
+    for (; p < end && !(*p & 0x80); p++)
+        *p = _ascii_char_case(*p, upper);
+    return p;
+}
+
+// Skip ASCII bytes from p, returning the first non-ASCII byte or end.
+static const char *_skip_ascii(const char *p, const char *end)
+{
+#ifdef __SSE2__
+    for (; end - p >= 16; p += 16)
+    {
+        const int mask = _mm_movemask_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        if (mask)
+            return p + __builtin_ctz(mask);
+    }
+#endif
+    while (p < end && !(*p & 0x80))
+        p++;
+    return p;
+}
+
+// Append the rest of the string, from p, to out with its case changed.
+// (p must be in a NUL-terminated string, for utf8towc.)
+static void _append_case(const char *p, const char *end, case_kind kind,
+                         string &out)
+{
+    while (p < end)
+    {
+        const char *ascii_end = _skip_ascii(p, end);
+        const size_t start = out.length();
+        out.append(p, ascii_end);
+        _ascii_case(&out[start], &out[0] + out.length(), kind != CASE_LOWER);
+        p = ascii_end;
+        if (p == end)
+            break;
+
+        char32_t c;
+        const int len = utf8towc(&c, p);
+        char buf[16];
+        const int mapped_len = _map_char(c, kind, buf);
+        if (mapped_len)
+            out.append(buf, mapped_len);
+        else
+            out.append(p, len);
+        p += len;
+    }
+}
+
+static void _change_case(string &s, case_kind kind)
+{
+    if (s.empty())
+        return;
+
+    char *p = &s[0];
+    char *end = p + s.length();
+    while (true)
+    {
+        p = _ascii_case(p, end, kind != CASE_LOWER);
+        if (p == end)
+            return;
+
+        char32_t c;
+        const int len = utf8towc(&c, p);
+        char buf[16];
+        const int mapped_len = _map_char(c, kind, buf);
+        if (mapped_len == len)
+            memcpy(p, buf, len);
+        else if (mapped_len)
+        {
+            // The length changes, so finish off in a new string.
+            string out;
+            out.reserve(s.length() + mapped_len);
+            out.append(&s[0], p);
+            out.append(buf, mapped_len);
+            _append_case(p + len, end, kind, out);
+            s.swap(out);
+            return;
+        }
+        p += len;
+    }
+}
+
+static void _change_first_case(string &s, case_kind kind)
+{
+    if (s.empty())
+        return;
+
+    if (!(s[0] & 0x80))
+    {
+        s[0] = _ascii_char_case(s[0], kind != CASE_LOWER);
+        return;
+    }
+
+    char32_t c;
+    const int len = utf8towc(&c, s.c_str());
+    char buf[16];
+    const int mapped_len = _map_char(c, kind, buf);
+    if (mapped_len == len)
+        memcpy(&s[0], buf, len);
+    else if (mapped_len)
+        s.replace(0, len, buf, mapped_len);
+}
+
+void utf8_lowercase(string &s)
+{
+    _change_case(s, CASE_LOWER);
+}
+
+void utf8_uppercase(string &s)
+{
+    _change_case(s, CASE_UPPER);
+}
+
+void utf8_lowercase_first(string &s)
+{
+    _change_first_case(s, CASE_LOWER);
+}
+
+void utf8_titlecase_first(string &s)
+{
+    _change_first_case(s, CASE_TITLE);
+}
@@ -0,0 +1,21 @@
+/**
+ * @file
+ * @brief Unicode case mapping of UTF-8 strings, independent of the locale.
+ *
+ * These are the full mappings, so may change the length: "ß" upper cases to
+ * "SS" and title cases to "Ss". There's no language-specific tailoring
+ * (Turkish dotted i, final sigma), and ASCII always maps to ASCII.
+**/
+
+#pragma once
+
+#include <string>
+using std::string;
+
+// Change the case of all of s, in place where possible.
+void utf8_lowercase(string &s);
+void utf8_uppercase(string &s);
+
+// Change the case of the first character of s only.
+void utf8_lowercase_first(string &s);
+void utf8_titlecase_first(string &s);
@@ -0,0 +1,310 @@
+/**
+ * @file  xlate-profile.cc
+ * @brief Optional instrumentation of translation lookups.
+ **/
+
+#include "xlate-profile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <tuple>
+using namespace std;
+
+#ifndef XLATE_PROFILE
+//// compile without instrumentation ////
+
+bool xlate_profile_enabled()
+{
+    return false;
+}
+
+void xlate_profile_reset()
+{
+}
+
+vector<xlate_profile_entry> xlate_profile_top(xlate_profile_order,
+                                              size_t)
+{
+    return vector<xlate_profile_entry>();
+}
+
+static unsigned long _dropped_lookups()
+{
+    return 0;
+}
+
+#else
+//// compile with instrumentation ////
+
+#include <atomic>
+#include <functional>
+
+// Number of distinct keys each thread can track. Lookups of keys beyond this
+// are counted as dropped rather than growing the table, so that a reader
+// never sees the table change shape under it.
+static const size_t PROF_SLOTS = 8192;
+
+namespace
+{
+    struct prof_key
+    {
+        string domain;
+        string context;
+        string msgid;
+    };
+
+    struct prof_slot
+    {
+        atomic<const prof_key*> key;
+        atomic<unsigned long> hits;
+        atomic<unsigned long> misses;
+        atomic<unsigned long> context_misses;
+        atomic<unsigned long long> nanos;
+    };
+
+    // One per thread. Only the owning thread inserts keys or touches
+    // counters (including zeroing them); everybody else just reads.
+    struct prof_table
+    {
+        prof_slot slots[PROF_SLOTS];
+        atomic<unsigned long> dropped;
+        // the reset this table's counters were last cleared for
+        atomic<unsigned long> generation;
+        prof_table *next;
+    };
+}
+
+// all thread tables ever created (never freed, so that counts survive the
+// thread that made them)
+static atomic<prof_table*> all_tables(nullptr);
+
+// bumped by xlate_profile_reset(); a table whose generation is behind this
+// still holds counts from before the reset
+static atomic<unsigned long> reset_generation(0);
+
+static prof_table *_new_table()
+{
+    prof_table *table = new prof_table();
+    table->generation.store(reset_generation.load(memory_order_acquire),
+                            memory_order_relaxed);
+    table->next = all_tables.load(memory_order_relaxed);
+    while (!all_tables.compare_exchange_weak(table->next, table,
+                                             memory_order_release,
+                                             memory_order_relaxed))
+    {
+    }
+    return table;
+}
+
+static prof_table &_thread_table()
+{
+    static thread_local prof_table *table = _new_table();
+    return *table;
+}
+
+static size_t _hash_key(const string &domain, const string &context,
+                        const string &msgid)
+{
+    hash<string> h;
+    size_t result = h(msgid);
+    result ^= h(context) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    result ^= h(domain) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    return result;
+}
+
+// find (or claim) the slot for a key in the calling thread's table
+static prof_slot *_find_slot(prof_table &table, const string &domain,
+                             const string &context, const string &msgid)
+{
+    size_t index = _hash_key(domain, context, msgid) % PROF_SLOTS;
+    for (size_t probes = 0; probes < PROF_SLOTS; ++probes)
+    {
+        prof_slot &slot = table.slots[index];
+        const prof_key *key = slot.key.load(memory_order_relaxed);
+        if (key == nullptr)
+        {
+            // counters are still zero, so it's safe to publish the key now
+            slot.key.store(new prof_key{domain, context, msgid},
+                           memory_order_release);
+            return &slot;
+        }
+        if (key->msgid == msgid && key->context == context
+            && key->domain == domain)
+        {
+            return &slot;
+        }
+        index = (index + 1) % PROF_SLOTS;
+    }
+    return nullptr;
+}
+
+// is the table up to date with the last reset?
+static bool _table_current(const prof_table &table)
+{
+    return table.generation.load(memory_order_acquire)
+           == reset_generation.load(memory_order_acquire);
+}
+
+// zero the calling thread's own counters after a reset
+static void _clear_table(prof_table &table, unsigned long generation)
+{
+    for (prof_slot &slot : table.slots)
+    {
+        slot.hits.store(0, memory_order_relaxed);
+        slot.misses.store(0, memory_order_relaxed);
+        slot.context_misses.store(0, memory_order_relaxed);
+        slot.nanos.store(0, memory_order_relaxed);
+    }
+    table.dropped.store(0, memory_order_relaxed);
+    table.generation.store(generation, memory_order_release);
+}
+
+void xlate_profile_record(const string &domain, const string &context,
+                          const string &msgid, bool found,
+                          bool context_miss, unsigned long long nanos)
+{
+    prof_table &table = _thread_table();
+    const unsigned long generation
+        = reset_generation.load(memory_order_acquire);
+    if (table.generation.load(memory_order_relaxed) != generation)
+        _clear_table(table, generation);
+
+    prof_slot *slot = _find_slot(table, domain, context, msgid);
+    if (slot == nullptr)
+    {
+        table.dropped.fetch_add(1, memory_order_relaxed);
+        return;
+    }
+
+    // single writer, so plain load/store pairs are enough
+    if (found)
+        slot->hits.store(slot->hits.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    else
+        slot->misses.store(slot->misses.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    if (context_miss)
+    {
+        slot->context_misses.store(slot->context_misses.load(memory_order_relaxed) + 1,
+                                   memory_order_relaxed);
+    }
+    slot->nanos.store(slot->nanos.load(memory_order_relaxed) + nanos, memory_order_relaxed);
+}
+
+bool xlate_profile_enabled()
+{
+    return true;
+}
+
+// Other threads' counters can't be zeroed from here without racing their
+// increments, so just move on a generation: each thread clears its own table
+// on its next lookup, and until then readers ignore it.
+void xlate_profile_reset()
+{
+    reset_generation.fetch_add(1, memory_order_acq_rel);
+}
+
+static unsigned long _dropped_lookups()
+{
+    unsigned long dropped = 0;
+    for (prof_table *table = all_tables.load(memory_order_acquire);
+         table != nullptr; table = table->next)
+    {
+        if (_table_current(*table))
+            dropped += table->dropped.load(memory_order_relaxed);
+    }
+    return dropped;
+}
+
+vector<xlate_profile_entry> xlate_profile_top(xlate_profile_order order,
+                                              size_t n)
+{
+    // merge all the thread tables
+    map<tuple<string, string, string>, xlate_profile_entry> merged;
+    for (prof_table *table = all_tables.load(memory_order_acquire);
+         table != nullptr; table = table->next)
+    {
+        if (!_table_current(*table))
+            continue;
+
+        for (const prof_slot &slot : table->slots)
+        {
+            const prof_key *key = slot.key.load(memory_order_acquire);
+            if (key == nullptr)
+                continue;
+
+            xlate_profile_entry &entry
+                = merged[make_tuple(key->domain, key->context, key->msgid)];
+            entry.domain = key->domain;
+            entry.context = key->context;
+            entry.msgid = key->msgid;
+            entry.hits += slot.hits.load(memory_order_relaxed);
+            entry.misses += slot.misses.load(memory_order_relaxed);
+            entry.context_misses += slot.context_misses.load(memory_order_relaxed);
+            entry.nanos += slot.nanos.load(memory_order_relaxed);
+        }
+    }
+
+    vector<xlate_profile_entry> results;
+    for (const auto &it : merged)
+    {
+        const xlate_profile_entry &entry = it.second;
+        if (order == XPROF_MISSING && entry.misses == 0)
+            continue;
+        if (entry.lookups() > 0)
+            results.push_back(entry);
+    }
+
+    stable_sort(results.begin(), results.end(),
+                [order](const xlate_profile_entry &a, const xlate_profile_entry &b)
+                {
+                    if (order == XPROF_MISSING)
+                        return a.misses > b.misses;
+                    else if (order == XPROF_SLOWEST)
+                        return a.nanos > b.nanos;
+                    else
+                        return a.lookups() > b.lookups();
+                });
+
+    if (n > 0 && results.size() > n)
+        results.resize(n);
+    return results;
+}
+
+#endif
+
+static string _format_entries(const vector<xlate_profile_entry> &entries)
+{
+    string result;
+    char buf[128];
+    for (const xlate_profile_entry &entry : entries)
+    {
+        snprintf(buf, sizeof(buf), "%8lu %8lu %8lu %12.1f  ",
+                 entry.hits, entry.misses, entry.context_misses,
+                 entry.nanos / 1000.0);
+        result += buf;
+        if (!entry.domain.empty())
+            result += "[" + entry.domain + "] ";
+        if (!entry.context.empty())
+            result += "{" + entry.context + "} ";
+        result += entry.msgid + "\n";
+    }
+    return result;
+}
+
+string xlate_profile_dump(size_t n)
+{
+    if (!xlate_profile_enabled())
+        return "translation profiling not compiled in (build with XLATE_PROFILE)\n";
+
+    const string header = "    hits   misses ctx-miss     total-us  key\n";
+
+    string result = "Hottest translation keys:\n" + header;
+    result += _format_entries(xlate_profile_top(XPROF_HOTTEST, n));
+    result += "\nKeys falling back to English:\n" + header;
+    result += _format_entries(xlate_profile_top(XPROF_MISSING, n));
+
+    const unsigned long dropped = _dropped_lookups();
+    if (dropped > 0)
+        result += "\n" + to_string(dropped) + " lookups not tracked (table full)\n";
+    return result;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file  xlate-profile.h
+ * @brief Optional instrumentation of translation lookups.
+ *
+ * Records, per (domain, context, msgid), how often the key was looked up,
+ * how often it fell back to English and how long the lookups took.
+ * Only compiled in when XLATE_PROFILE is defined (make XLATE_PROFILE=1).
+ * Otherwise the lookup routines are not instrumented at all and the query
+ * functions below just return empty results.
+ **/
+
+#pragma once
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+struct xlate_profile_entry
+{
+    string domain;
+    string context;
+    string msgid;
+
+    // lookups which found a translation
+    unsigned long hits = 0;
+    // lookups which fell back to the English text
+    unsigned long misses = 0;
+    // lookups with a context which only succeeded at global (no) context
+    unsigned long context_misses = 0;
+    // cumulative time spent looking this key up
+    unsigned long long nanos = 0;
+
+    unsigned long lookups() const { return hits + misses; }
+};
+
+enum xlate_profile_order
+{
+    XPROF_HOTTEST,  // most lookups first
+    XPROF_MISSING,  // most fallbacks to English first
+    XPROF_SLOWEST,  // most cumulative lookup time first
+};
+
+// is instrumentation compiled in?
+bool xlate_profile_enabled();
+
+// zero all counters (keys seen so far are kept); safe while other threads
+// are looking things up, since each thread zeroes its own counters on its
+// next lookup and until then they are left out of the reports
+void xlate_profile_reset();
+
+// merge the counters of all threads and return the top n entries
+// (all entries if n == 0) in the given order
+vector<xlate_profile_entry> xlate_profile_top(xlate_profile_order order,
+                                              size_t n = 0);
+
+// human-readable report of the n hottest and n most missed keys
+string xlate_profile_dump(size_t n = 20);
+
+#ifdef XLATE_PROFILE
+#include <chrono>
+
+// Accumulates one lookup into the calling thread's counters.
+// The calling thread's table is only ever written by that thread, so this
+// takes no locks; readers merge the tables with atomic loads.
+void xlate_profile_record(const string &domain, const string &context,
+                          const string &msgid, bool found,
+                          bool context_miss, unsigned long long nanos);
+
+// Times a lookup for the lifetime of the object.
+class xlate_profile_timer
+{
+public:
+    xlate_profile_timer(const string &domain, const string &context,
+                        const string &msgid)
+        : m_domain(domain), m_context(context), m_msgid(msgid),
+          m_found(false), m_context_miss(false),
+          m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~xlate_profile_timer()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - m_start;
+        xlate_profile_record(m_domain, m_context, m_msgid, m_found,
+                             m_context_miss,
+                             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    void found(bool f) { m_found = f; }
+    void context_miss(bool m) { m_context_miss = m; }
+
+private:
+    const string &m_domain;
+    const string &m_context;
+    const string &m_msgid;
+    bool m_found;
+    bool m_context_miss;
+    std::chrono::steady_clock::time_point m_start;
+};
+#endif
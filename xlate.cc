@@ -6,6 +6,7 @@
  **/
 
 #include "xlate.h"
+#include "xlate-profile.h"
 
 #include <cstring>
 using namespace std;
@@ -22,6 +23,10 @@ string get_xlate_language()
     return "";
 }
 
+void set_xlate_language(const string &lang)
+{
+}
+
 string dcxlate(const string &domain, const string &context, const string &msgid)
 {
     return msgid;
@@ -33,6 +38,19 @@ string dcnxlate(const string &domain, const string &context,
     return (n == 1 ? msgid1 : msgid2);
 }
 
+bool dcxlate_exact(const string &domain, const string &context,
+        const string &msgid, string &translation)
+{
+    return false;
+}
+
+bool dcnxlate_exact(const string &domain, const string &context,
+        const string &msgid1, const string &msgid2, unsigned long n,
+        string &translation)
+{
+    return false;
+}
+
 #else
 //// compile with translation logic ////
 
@@ -51,16 +69,12 @@ void init_xlate(const string &lang)
     // this also probably won't work if the user's locale is not unicode (TODO: test that)
     setlocale(LC_ALL, "");
 
-    language = lang;
-    setenv("LANGUAGE", language.c_str(), 1);
-
     bindtextdomain("context-map", "./locale");
     bindtextdomain("messages", "./locale");
     bindtextdomain("entities", "./locale");
     bindtextdomain("monsters", "./locale");
 
-    // set default domain
-    textdomain(DEFAULT_DOMAIN.c_str());
+    set_xlate_language(lang);
 }
 
 const string& get_xlate_language()
@@ -68,6 +82,17 @@ const string& get_xlate_language()
     return language;
 }
 
+// switch language (after init_xlate)
+void set_xlate_language(const string &lang)
+{
+    language = lang;
+    setenv("LANGUAGE", language.c_str(), 1);
+
+    // set default domain
+    // (this also makes gettext drop translations cached for the old language)
+    textdomain(DEFAULT_DOMAIN.c_str());
+}
+
 // skip translation if language is English (or unspecified which implies English)
 static inline bool skip_translation()
 {
@@ -92,6 +117,10 @@ string dcxlate(const string &domain, const string &context, const string &msgid)
         return msgid;
     }
 
+#ifdef XLATE_PROFILE
+    xlate_profile_timer timer(domain, context, msgid);
+#endif
+
     // if domain not specified then fall back to default by passing NULL
     const char *dom = (domain.empty() ? NULL : domain.c_str());
 
@@ -116,7 +145,17 @@ string dcxlate(const string &domain, const string &context, const string &msgid)
         {
             translation = xlation;
         }
+#ifdef XLATE_PROFILE
+        const bool found = xlation != NULL && msgid != xlation;
+        timer.found(found);
+        // found, but only once the specific context had been tried
+        timer.context_miss(found && !context.empty());
+#endif
     }
+#ifdef XLATE_PROFILE
+    else
+        timer.found(true);
+#endif
 
     return translation;
 }
@@ -144,6 +183,10 @@ string dcnxlate(const string &domain, const string &context,
         return (n == 1 ? msgid1 : msgid2);
     }
 
+#ifdef XLATE_PROFILE
+    xlate_profile_timer timer(domain, context, msgid1);
+#endif
+
     // if domain not specified then fall back to default by passing NULL
     const char *dom = (domain.empty() ? NULL : domain.c_str());
 
@@ -169,7 +212,17 @@ string dcnxlate(const string &domain, const string &context,
         {
             translation = xlation;
         }
+#ifdef XLATE_PROFILE
+        const bool found = xlation != NULL && msgid1 != xlation && msgid2 != xlation;
+        timer.found(found);
+        // found, but only once the specific context had been tried
+        timer.context_miss(found && !context.empty());
+#endif
     }
+#ifdef XLATE_PROFILE
+    else
+        timer.found(true);
+#endif
 
     if (translation.empty())
     {
@@ -180,4 +233,65 @@ string dcnxlate(const string &domain, const string &context,
     return translation;
 }
 
+// translate only if there is a translation in exactly this context
+// (empty context means global context)
+// returns false and leaves translation alone if there isn't one
+bool dcxlate_exact(const string &domain, const string &context,
+        const string &msgid, string &translation)
+{
+    if (skip_translation() || msgid.empty())
+        return false;
+
+#ifdef XLATE_PROFILE
+    xlate_profile_timer timer(domain, context, msgid);
+#endif
+
+    const char *dom = (domain.empty() ? NULL : domain.c_str());
+
+    string key = msgid;
+    if (!context.empty())
+        key = context + GETTEXT_CTXT_GLUE + msgid;
+
+    const char *xlation = dgettext(dom, key.c_str());
+    const bool found = (xlation != NULL && key != xlation);
+#ifdef XLATE_PROFILE
+    timer.found(found);
+#endif
+    if (found)
+        translation = xlation;
+    return found;
+}
+
+// same, with number
+bool dcnxlate_exact(const string &domain, const string &context,
+        const string &msgid1, const string &msgid2, unsigned long n,
+        string &translation)
+{
+    if (skip_translation() || msgid1.empty() || msgid2.empty())
+        return false;
+
+#ifdef XLATE_PROFILE
+    xlate_profile_timer timer(domain, context, msgid1);
+#endif
+
+    const char *dom = (domain.empty() ? NULL : domain.c_str());
+
+    string key1 = msgid1;
+    string key2 = msgid2;
+    if (!context.empty())
+    {
+        key1 = context + GETTEXT_CTXT_GLUE + msgid1;
+        key2 = context + GETTEXT_CTXT_GLUE + msgid2;
+    }
+
+    const char *xlation = dngettext(dom, key1.c_str(), key2.c_str(), n);
+    const bool found = (xlation != NULL && key1 != xlation && key2 != xlation);
+#ifdef XLATE_PROFILE
+    timer.found(found);
+#endif
+    if (found)
+        translation = xlation;
+    return found;
+}
+
 #endif
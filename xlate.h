@@ -14,6 +14,9 @@ void init_xlate(const string &lang);
 
 const string& get_xlate_language();
 
+// switch to a different language without re-initializing
+void set_xlate_language(const string &lang);
+
 // translate with domain and context
 //
 // domain = translation file (optional, default="messages")
@@ -36,6 +39,17 @@ string dcxlate(const string &domain, const string &context, const string &msgid)
 string dcnxlate(const string &domain, const string &context,
         const string &msgid1, const string &msgid2, unsigned long n);
 
+// translate only if there is a translation in exactly this context
+// (no fallback to the global context, which is what an empty context means)
+// returns false and leaves translation alone if there isn't one
+bool dcxlate_exact(const string &domain, const string &context,
+        const string &msgid, string &translation);
+
+// same, with number
+bool dcnxlate_exact(const string &domain, const string &context,
+        const string &msgid1, const string &msgid2, unsigned long n,
+        string &translation);
+
 // translate with context (use default domain)
 static inline string cxlate(const string &context, const string &msgid)
 {